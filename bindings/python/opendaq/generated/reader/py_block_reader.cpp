@@ -79,6 +79,23 @@ void defineIBlockReader(pybind11::module_ m, PyDaqIntf<daq::IBlockReader, daq::I
         py::arg("timeout_ms") = 0,
         "Copies at maximum the next `count` blocks of unread samples and clock-stamps to the `dataBlocks` and `domainBlocks` buffers."
         "The amount actually read is returned through the `count` parameter.");
+    cls.def(
+        "read_into",
+        [](daq::IBlockReader* object, py::array& values, const size_t timeoutMs)
+        { return PyTypedReader::readValuesInto(daq::BlockReaderPtr::Borrow(object), values, timeoutMs); },
+        py::arg("values").noconvert(),
+        py::arg("timeout_ms") = 0,
+        "Reads at maximum as many blocks as fit into the preallocated, C-contiguous `values` array of the value read type. "
+        "Returns the amount of blocks actually read.");
+    cls.def(
+        "read_with_domain_into",
+        [](daq::IBlockReader* object, py::array& values, py::array& domain, const size_t timeoutMs)
+        { return PyTypedReader::readValuesWithDomainInto(daq::BlockReaderPtr::Borrow(object), values, domain, timeoutMs); },
+        py::arg("values").noconvert(),
+        py::arg("domain").noconvert(),
+        py::arg("timeout_ms") = 0,
+        "Reads at maximum as many blocks and clock-stamps as fit into the preallocated, C-contiguous `values` and `domain` "
+        "arrays of the read types. Returns the amount of blocks actually read.");
 
     cls.def_property_readonly(
         "block_size",
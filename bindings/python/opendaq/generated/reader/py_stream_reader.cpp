@@ -64,4 +64,21 @@ void defineIStreamReader(pybind11::module_ m, PyDaqIntf<daq::IStreamReader, daq:
         py::arg("timeout_ms") = 0,
         "Copies at maximum the next `count` unread samples and clock-stamps to the `values` and `stamps` buffers. The amount actually read "
         "is returned through the `count` parameter.");
+    cls.def(
+        "read_into",
+        [](daq::IStreamReader* object, py::array& values, const size_t timeoutMs)
+        { return PyTypedReader::readValuesInto(daq::StreamReaderPtr::Borrow(object), values, timeoutMs); },
+        py::arg("values").noconvert(),
+        py::arg("timeout_ms") = 0,
+        "Reads at maximum as many samples as fit into the preallocated, C-contiguous `values` array of the value read type. "
+        "Returns the amount of samples actually read.");
+    cls.def(
+        "read_with_domain_into",
+        [](daq::IStreamReader* object, py::array& values, py::array& domain, const size_t timeoutMs)
+        { return PyTypedReader::readValuesWithDomainInto(daq::StreamReaderPtr::Borrow(object), values, domain, timeoutMs); },
+        py::arg("values").noconvert(),
+        py::arg("domain").noconvert(),
+        py::arg("timeout_ms") = 0,
+        "Reads at maximum as many samples and clock-stamps as fit into the preallocated, C-contiguous `values` and `domain` "
+        "arrays of the read types. Returns the amount of samples actually read.");
 }
@@ -76,4 +76,11 @@ void defineIScheduler(pybind11::module_ m, PyDaqIntf<daq::IScheduler, daq::IBase
             return objectPtr.isMultiThreaded();
         },
         "Returns whether more than one worker thread is used.");
+    cls.def_property_readonly("worker_count",
+        [](daq::IScheduler *object)
+        {
+            const auto objectPtr = daq::SchedulerPtr::Borrow(object);
+            return objectPtr.getWorkerCount();
+        },
+        "Gets the number of worker threads used by the scheduler.");
 }
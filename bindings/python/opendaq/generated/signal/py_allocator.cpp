@@ -42,6 +42,7 @@ void defineIAllocator(pybind11::module_ m, PyDaqIntf<daq::IAllocator, daq::IBase
     m.def("MiMallocAllocator", &daq::MiMallocAllocator_Create);
 #endif
     m.def("ExternalAllocator", &daq::ExternalAllocator_Create);
+    m.def("PoolAllocator", &daq::PoolAllocator_Create);
 
     cls.def("allocate",
         [](daq::IAllocator *object, daq::IDataDescriptor* descriptor, const size_t bytes, const size_t align)
@@ -269,6 +269,144 @@ private:
         return {std::move(valuesArray), std::move(domainArray)};
     }
 
+    /*
+     * Reads directly into the buffers of caller-allocated NumPy arrays. The arrays must be C-contiguous, writeable
+     * and of the reader's read types. The amount read is limited by the array size and the GIL is released while the
+     * reader waits for the samples.
+     */
+    template <typename ReaderType>
+    static inline size_t readValuesInto(const ReaderType& reader, py::array& values, size_t timeoutMs)
+    {
+        daq::SampleType valueType = daq::SampleType::Undefined;
+        reader->getValueReadType(&valueType);
+        const size_t blockSize = getBlockSize(reader);
+
+        return dispatchSampleType(valueType,
+                                  "values",
+                                  [&](auto valueTag)
+                                  {
+                                      using ValueType = typename decltype(valueTag)::Type;
+                                      auto valuesData = getOutputBuffer<ValueType>(values, blockSize, "values");
+                                      size_t count = values.size() / blockSize;
+
+                                      daq::ErrCode errCode;
+                                      {
+                                          py::gil_scoped_release release;
+                                          if constexpr (ReaderHasReadWithTimeout<ReaderType, ValueType>::value)
+                                              errCode = reader->read(valuesData, &count, timeoutMs, nullptr);
+                                          else
+                                              errCode = reader->read(valuesData, &count, nullptr);
+                                      }
+                                      daq::checkErrorInfo(errCode);
+                                      return count;
+                                  });
+    }
+
+    template <typename ReaderType>
+    static inline size_t readValuesWithDomainInto(const ReaderType& reader, py::array& values, py::array& domain, size_t timeoutMs)
+    {
+        daq::SampleType valueType = daq::SampleType::Undefined;
+        daq::SampleType domainType = daq::SampleType::Undefined;
+        reader->getValueReadType(&valueType);
+        reader->getDomainReadType(&domainType);
+        const size_t blockSize = getBlockSize(reader);
+
+        if (values.size() != domain.size())
+            throw daq::InvalidParameterException("The values and domain arrays must be of the same size");
+
+        return dispatchSampleType(
+            valueType,
+            "values",
+            [&](auto valueTag)
+            {
+                using ValueType = typename decltype(valueTag)::Type;
+                auto valuesData = getOutputBuffer<ValueType>(values, blockSize, "values");
+
+                return dispatchSampleType(domainType,
+                                          "domain",
+                                          [&](auto domainTag)
+                                          {
+                                              using DomainType = typename decltype(domainTag)::Type;
+                                              auto domainData = getOutputBuffer<DomainType>(domain, blockSize, "domain");
+                                              size_t count = values.size() / blockSize;
+
+                                              daq::ErrCode errCode;
+                                              {
+                                                  py::gil_scoped_release release;
+                                                  if constexpr (ReaderHasReadWithTimeout<ReaderType, ValueType>::value)
+                                                      errCode = reader->readWithDomain(valuesData, domainData, &count, timeoutMs, nullptr);
+                                                  else
+                                                      errCode = reader->readWithDomain(valuesData, domainData, &count, nullptr);
+                                              }
+                                              daq::checkErrorInfo(errCode);
+                                              return count;
+                                          });
+            });
+    }
+
+    template <typename T>
+    struct SampleTypeTag
+    {
+        using Type = T;
+    };
+
+    template <typename Func>
+    static inline size_t dispatchSampleType(daq::SampleType type, const std::string& name, Func&& func)
+    {
+        switch (type)
+        {
+            case daq::SampleType::Float32:
+                return func(SampleTypeTag<daq::SampleTypeToType<daq::SampleType::Float32>::Type>{});
+            case daq::SampleType::Float64:
+                return func(SampleTypeTag<daq::SampleTypeToType<daq::SampleType::Float64>::Type>{});
+            case daq::SampleType::UInt32:
+                return func(SampleTypeTag<daq::SampleTypeToType<daq::SampleType::UInt32>::Type>{});
+            case daq::SampleType::Int32:
+                return func(SampleTypeTag<daq::SampleTypeToType<daq::SampleType::Int32>::Type>{});
+            case daq::SampleType::UInt64:
+                return func(SampleTypeTag<daq::SampleTypeToType<daq::SampleType::UInt64>::Type>{});
+            case daq::SampleType::Int64:
+                return func(SampleTypeTag<daq::SampleTypeToType<daq::SampleType::Int64>::Type>{});
+            case daq::SampleType::UInt8:
+                return func(SampleTypeTag<daq::SampleTypeToType<daq::SampleType::UInt8>::Type>{});
+            case daq::SampleType::Int8:
+                return func(SampleTypeTag<daq::SampleTypeToType<daq::SampleType::Int8>::Type>{});
+            case daq::SampleType::UInt16:
+                return func(SampleTypeTag<daq::SampleTypeToType<daq::SampleType::UInt16>::Type>{});
+            case daq::SampleType::Int16:
+                return func(SampleTypeTag<daq::SampleTypeToType<daq::SampleType::Int16>::Type>{});
+            default:
+                throw std::runtime_error("Unsupported " + name + " sample type: " + convertSampleTypeToString(type));
+        }
+    }
+
+    template <typename ValueType>
+    static inline ValueType* getOutputBuffer(py::array& array, size_t blockSize, const std::string& name)
+    {
+        if (!py::isinstance<py::array_t<ValueType>>(array))
+            throw daq::InvalidParameterException("The " + name + " array must be of dtype " +
+                                                 py::str(py::dtype::of<ValueType>()).cast<std::string>());
+        if (!(array.flags() & py::array::c_style))
+            throw daq::InvalidParameterException("The " + name + " array must be C-contiguous");
+        if (!array.writeable())
+            throw daq::InvalidParameterException("The " + name + " array must be writeable");
+        if (array.size() % blockSize != 0)
+            throw daq::InvalidParameterException("The " + name + " array size must be a multiple of the block size");
+
+        return static_cast<ValueType*>(array.mutable_data());
+    }
+
+    template <typename ReaderType>
+    static inline size_t getBlockSize(const ReaderType& reader)
+    {
+        size_t blockSize = 1;
+        if constexpr (std::is_same_v<ReaderType, daq::BlockReaderPtr>)
+        {
+            reader->getBlockSize(&blockSize);
+        }
+        return blockSize;
+    }
+
     static inline void checkSampleType(daq::SampleType type)
     {
         switch (type)
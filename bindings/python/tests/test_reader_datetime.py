@@ -206,6 +206,52 @@ class TestReaderDateTime(opendaq_test.TestCase):
             for tt in t:
                 self.assertIsInstance(tt, numpy.datetime64)
 
+    def test_read_into(self):
+        mock = opendaq.MockSignal()
+        reader = opendaq.StreamReader(mock.signal)
+
+        mock.add_data(numpy.arange(10))
+
+        values = numpy.zeros(6, dtype=numpy.float64)
+        domain = numpy.zeros(6, dtype=numpy.int64)
+        self.assertEqual(reader.read_with_domain_into(values, domain), 6)
+        self.assertTrue(numpy.array_equal(values, numpy.arange(6)))
+
+        self.assertEqual(reader.read_into(values), 4)
+        self.assertTrue(numpy.array_equal(values[:4], numpy.arange(6, 10)))
+
+    def test_read_into_invalid_array(self):
+        mock = opendaq.MockSignal()
+        reader = opendaq.StreamReader(mock.signal)
+
+        with self.assertRaises(RuntimeError):
+            reader.read_into(numpy.zeros(10, dtype=numpy.int32))
+        with self.assertRaises(RuntimeError):
+            reader.read_into(numpy.zeros(20, dtype=numpy.float64)[::2])
+        with self.assertRaises(TypeError):
+            reader.read_into([0.0] * 10)
+
+    def test_tail_read_into(self):
+        mock = opendaq.MockSignal()
+        reader = opendaq.TailReader(mock.signal, 10)
+
+        mock.add_data(numpy.arange(10))
+
+        values = numpy.zeros(4, dtype=numpy.float64)
+        self.assertEqual(reader.read_into(values), 4)
+        self.assertTrue(numpy.array_equal(values, numpy.arange(6, 10)))
+
+    def test_block_read_into(self):
+        mock = opendaq.MockSignal()
+        reader = opendaq.BlockReader(mock.signal, 2)
+
+        mock.add_data(numpy.arange(10))
+
+        values = numpy.zeros((5, 2), dtype=numpy.float64)
+        self.assertEqual(reader.read_into(values), 5)
+        self.assertTrue(numpy.array_equal(
+            values, numpy.arange(10).reshape(5, 2)))
+
 
 if __name__ == '__main__':
     unittest.main()
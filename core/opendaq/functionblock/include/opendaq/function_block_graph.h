@@ -0,0 +1,83 @@
+/*
+ * Copyright 2022-2023 Blueberry d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <opendaq/folder_ptr.h>
+#include <opendaq/logger_ptr.h>
+#include <opendaq/scheduler_ptr.h>
+#include <memory>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+struct FunctionBlockGraphState;
+
+/*!
+ * @ingroup opendaq_function_block
+ * @brief Processes the function blocks below a component as one task graph on the scheduler.
+ *
+ * `build` collects all function blocks with input ports below the root component and links them
+ * by the connections of their input ports. Packets enqueued on input ports whose signals do not
+ * originate from a function block of the graph (e.g. device channel signals) request a run of the
+ * graph. A run calls `packetReceived` of each function block with queued packets once all of its
+ * upstream function blocks have finished, so independent branches are processed in parallel on the
+ * scheduler workers. Requests made while a run is in progress are merged into a single follow-up run.
+ * Packets that a function block of the graph sends outside of a run (e.g. from its own acquisition thread)
+ * request a run as well.
+ *
+ * Only input ports whose listener is their function block are part of the graph; ports handed over to
+ * another listener, such as a reader created on the port, keep their own notifications.
+ *
+ * The graph does not track topology changes and has to be rebuilt when function blocks are added or
+ * removed, or when input ports are connected or disconnected.
+ */
+class FunctionBlockGraph
+{
+public:
+    FunctionBlockGraph(const SchedulerPtr& scheduler, const LoggerPtr& logger);
+    ~FunctionBlockGraph();
+
+    FunctionBlockGraph(const FunctionBlockGraph&) = delete;
+    FunctionBlockGraph& operator=(const FunctionBlockGraph&) = delete;
+
+    /*!
+     * @brief Builds the graph from the function blocks below @p root, replacing the previous one.
+     * @throws InvalidStateException if the function block connections form a cycle. The input ports
+     * are left in their default notification mode in that case.
+     */
+    void build(const FolderPtr& root);
+
+    /*!
+     * @brief Restores the input port listeners and waits for the runs in progress to finish.
+     *
+     * Must not be called from within the packet processing of a function block in the graph.
+     */
+    void clear();
+
+    /*!
+     * @brief Runs the graph once and waits for the run to finish.
+     */
+    void execute();
+
+    /*!
+     * @brief Gets the number of function blocks in the graph.
+     */
+    SizeT getFunctionBlockCount() const;
+
+private:
+    std::shared_ptr<FunctionBlockGraphState> state;
+};
+
+END_NAMESPACE_OPENDAQ
@@ -0,0 +1,518 @@
+#include <opendaq/function_block_graph.h>
+#include <opendaq/function_block_ptr.h>
+#include <opendaq/input_port_config_ptr.h>
+#include <opendaq/input_port_notifications_ptr.h>
+#include <opendaq/input_port_private_ptr.h>
+#include <opendaq/connection_ptr.h>
+#include <opendaq/awaitable_ptr.h>
+#include <opendaq/task_factory.h>
+#include <opendaq/search_filter_factory.h>
+#include <opendaq/logger_component_ptr.h>
+#include <opendaq/custom_log.h>
+#include <coretypes/intfs.h>
+#include <coretypes/procedure_factory.h>
+#include <coretypes/validation.h>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+enum class FunctionBlockGraphRunState
+{
+    Idle,
+    Scheduled,
+    Rescheduled
+};
+
+struct FunctionBlockGraphPort
+{
+    WeakRefPtr<IInputPortConfig> port;
+    WeakRefPtr<IInputPortNotifications> listener;
+    InputPortNotificationsPtr redirect;
+};
+
+// Set for every function block when a run is scheduled and cleared when the run reaches the function block
+using FunctionBlockGraphPendingFlag = std::shared_ptr<std::atomic<bool>>;
+
+struct FunctionBlockGraphState
+{
+    SchedulerPtr scheduler;
+    LoggerComponentPtr loggerComponent;
+
+    std::mutex sync;
+    TaskPtr graph;
+    AwaitablePtr lastRun;
+    SizeT functionBlockCount = 0;
+    std::vector<FunctionBlockGraphPort> ports;
+    std::vector<FunctionBlockGraphPendingFlag> pendingFlags;
+
+    // Graphs replaced by a rebuild are kept alive until their last run finishes
+    std::vector<std::pair<TaskPtr, AwaitablePtr>> retiredGraphs;
+
+    std::atomic<FunctionBlockGraphRunState> runState{FunctionBlockGraphRunState::Idle};
+};
+
+namespace
+{
+
+void pruneRetiredGraphs(FunctionBlockGraphState& state)
+{
+    auto& retired = state.retiredGraphs;
+    retired.erase(std::remove_if(retired.begin(),
+                                 retired.end(),
+                                 [](const std::pair<TaskPtr, AwaitablePtr>& entry)
+                                 { return !entry.second.assigned() || entry.second.hasCompleted(); }),
+                  retired.end());
+}
+
+void setPending(const FunctionBlockGraphState& state, bool pending)
+{
+    for (const auto& flag : state.pendingFlags)
+        flag->store(pending, std::memory_order_release);
+}
+
+void scheduleRun(const std::shared_ptr<FunctionBlockGraphState>& state)
+{
+    const auto& loggerComponent = state->loggerComponent;
+
+    std::scoped_lock lock(state->sync);
+    pruneRetiredGraphs(*state);
+
+    if (!state->graph.assigned())
+    {
+        state->runState.store(FunctionBlockGraphRunState::Idle, std::memory_order_release);
+        return;
+    }
+
+    try
+    {
+        setPending(*state, true);
+        state->lastRun = state->scheduler.scheduleGraph(state->graph);
+    }
+    catch (const std::exception& e)
+    {
+        setPending(*state, false);
+        state->runState.store(FunctionBlockGraphRunState::Idle, std::memory_order_release);
+        LOG_W("Failed to schedule function block graph: {}", e.what());
+    }
+}
+
+void requestRun(const std::shared_ptr<FunctionBlockGraphState>& state)
+{
+    auto current = state->runState.load(std::memory_order_acquire);
+    while (current != FunctionBlockGraphRunState::Rescheduled)
+    {
+        const auto next = current == FunctionBlockGraphRunState::Idle ? FunctionBlockGraphRunState::Scheduled
+                                                                       : FunctionBlockGraphRunState::Rescheduled;
+        if (state->runState.compare_exchange_weak(current, next, std::memory_order_acq_rel))
+        {
+            if (current == FunctionBlockGraphRunState::Idle)
+                scheduleRun(state);
+            return;
+        }
+    }
+}
+
+// Runs after every function block of a run; starts another run if one was requested meanwhile
+void finishRun(const std::shared_ptr<FunctionBlockGraphState>& state)
+{
+    auto current = state->runState.load(std::memory_order_acquire);
+    while (true)
+    {
+        if (current == FunctionBlockGraphRunState::Idle)
+            return;
+
+        if (current == FunctionBlockGraphRunState::Scheduled)
+        {
+            if (state->runState.compare_exchange_weak(current, FunctionBlockGraphRunState::Idle, std::memory_order_acq_rel))
+                return;
+        }
+        else if (state->runState.compare_exchange_weak(current, FunctionBlockGraphRunState::Scheduled, std::memory_order_acq_rel))
+        {
+            scheduleRun(state);
+            return;
+        }
+    }
+}
+
+class FunctionBlockGraphPortListener : public ImplementationOf<IInputPortNotifications>
+{
+public:
+    // Ports fed by function blocks of the graph pass the pending flag of the function block owning the port
+    FunctionBlockGraphPortListener(const InputPortNotificationsPtr& listener,
+                                   const std::weak_ptr<FunctionBlockGraphState>& state,
+                                   FunctionBlockGraphPendingFlag pending)
+        : listenerRef(listener)
+        , stateRef(state)
+        , pending(std::move(pending))
+    {
+    }
+
+    ErrCode INTERFACE_FUNC acceptsSignal(IInputPort* port, ISignal* signal, Bool* accept) override
+    {
+        OPENDAQ_PARAM_NOT_NULL(accept);
+
+        const auto listener = listenerRef.getRef();
+        if (!listener.assigned())
+        {
+            *accept = False;
+            return OPENDAQ_SUCCESS;
+        }
+
+        return listener->acceptsSignal(port, signal, accept);
+    }
+
+    ErrCode INTERFACE_FUNC connected(IInputPort* port) override
+    {
+        const auto listener = listenerRef.getRef();
+        return listener.assigned() ? listener->connected(port) : OPENDAQ_SUCCESS;
+    }
+
+    ErrCode INTERFACE_FUNC disconnected(IInputPort* port) override
+    {
+        const auto listener = listenerRef.getRef();
+        return listener.assigned() ? listener->disconnected(port) : OPENDAQ_SUCCESS;
+    }
+
+    ErrCode INTERFACE_FUNC packetReceived(IInputPort* port) override
+    {
+        OPENDAQ_PARAM_NOT_NULL(port);
+
+        return daqTry([this, port]
+        {
+            // Packets sent by an upstream function block of the graph are processed later in the same run. Only packets
+            // that arrive after the run reached this function block (e.g. sent from an acquisition thread of the upstream
+            // function block) or outside of a run need a run of their own.
+            if (pending)
+            {
+                if (pending->load(std::memory_order_acquire))
+                    return;
+
+                const auto connection = InputPortPtr::Borrow(port).getConnection();
+                if (!connection.assigned() || connection.getPacketCount() == 0)
+                    return;
+            }
+
+            const auto state = stateRef.lock();
+            if (state)
+                requestRun(state);
+        });
+    }
+
+private:
+    WeakRefPtr<IInputPortNotifications> listenerRef;
+    std::weak_ptr<FunctionBlockGraphState> stateRef;
+    FunctionBlockGraphPendingFlag pending;
+};
+
+struct FunctionBlockGraphNode
+{
+    FunctionBlockPtr functionBlock;
+    std::vector<InputPortConfigPtr> inputPorts;
+    std::vector<InputPortNotificationsPtr> inputPortListeners;
+    std::vector<bool> inputPortsExternal;
+    std::vector<size_t> successors;
+    size_t predecessorCount = 0;
+    FunctionBlockGraphPendingFlag pending = std::make_shared<std::atomic<bool>>(false);
+};
+
+template <typename T, typename U>
+bool isSameObject(const ObjectPtr<T>& lhs, const ObjectPtr<U>& rhs)
+{
+    return lhs.assigned() && rhs.assigned() && lhs.asPtr<IBaseObject>(true).getObject() == rhs.asPtr<IBaseObject>(true).getObject();
+}
+
+ProcedurePtr createNodeWork(const FunctionBlockGraphNode& node, const LoggerComponentPtr& loggerComponent)
+{
+    std::vector<std::pair<WeakRefPtr<IInputPortConfig>, WeakRefPtr<IInputPortNotifications>>> ports;
+    for (size_t i = 0; i < node.inputPorts.size(); ++i)
+        ports.emplace_back(node.inputPorts[i], node.inputPortListeners[i]);
+
+    return Procedure([ports = std::move(ports), pending = node.pending, loggerComponent]
+    {
+        pending->store(false, std::memory_order_release);
+
+        for (const auto& [portRef, listenerRef] : ports)
+        {
+            const auto port = portRef.getRef();
+            const auto listener = listenerRef.getRef();
+            if (!port.assigned() || !listener.assigned())
+                continue;
+
+            const auto connection = port.getConnection();
+            if (!connection.assigned() || connection.getPacketCount() == 0)
+                continue;
+
+            try
+            {
+                listener.packetReceived(port);
+            }
+            catch (const std::exception& e)
+            {
+                LOG_W("Function block graph packet processing failed: {}", e.what());
+            }
+        }
+    });
+}
+
+void restorePortListeners(FunctionBlockGraphState& state)
+{
+    for (const auto& entry : state.ports)
+    {
+        const auto port = entry.port.getRef();
+        const auto listener = entry.listener.getRef();
+        if (!port.assigned() || !listener.assigned())
+            continue;
+
+        // Listeners set while the graph was built (e.g. by a reader created on the port) are kept
+        if (isSameObject(port.asPtr<IInputPortPrivate>(true).getListener(), entry.redirect))
+            port.setListener(listener);
+    }
+
+    state.ports.clear();
+    state.pendingFlags.clear();
+}
+
+void retireGraph(FunctionBlockGraphState& state)
+{
+    restorePortListeners(state);
+
+    if (state.graph.assigned())
+        state.retiredGraphs.emplace_back(std::move(state.graph), std::move(state.lastRun));
+
+    state.graph = nullptr;
+    state.lastRun = nullptr;
+    state.functionBlockCount = 0;
+    pruneRetiredGraphs(state);
+}
+
+}
+
+FunctionBlockGraph::FunctionBlockGraph(const SchedulerPtr& scheduler, const LoggerPtr& logger)
+    : state(std::make_shared<FunctionBlockGraphState>())
+{
+    if (!scheduler.assigned())
+        throw ArgumentNullException("Scheduler must not be null");
+    if (!logger.assigned())
+        throw ArgumentNullException("Logger must not be null");
+
+    state->scheduler = scheduler;
+    state->loggerComponent = logger.getOrAddComponent("FunctionBlockGraph");
+}
+
+FunctionBlockGraph::~FunctionBlockGraph()
+{
+    try
+    {
+        clear();
+    }
+    catch (const std::exception& e)
+    {
+        const auto& loggerComponent = state->loggerComponent;
+        LOG_W("Failed to clear function block graph: {}", e.what());
+    }
+}
+
+void FunctionBlockGraph::build(const FolderPtr& root)
+{
+    if (!root.assigned())
+        throw ArgumentNullException("Root component must not be null");
+
+    const auto& loggerComponent = state->loggerComponent;
+
+    std::scoped_lock lock(state->sync);
+    retireGraph(*state);
+
+    std::vector<FunctionBlockGraphNode> nodes;
+    std::unordered_map<std::string, size_t> nodeIndices;
+
+    for (const auto& item : root.getItems(search::Recursive(search::InterfaceId(IFunctionBlock::Id))))
+    {
+        const auto functionBlock = item.asPtr<IFunctionBlock>();
+        const auto inputPorts = functionBlock.getInputPorts(search::Any());
+        if (inputPorts.empty())
+            continue;
+
+        FunctionBlockGraphNode node;
+        node.functionBlock = functionBlock;
+        for (const auto& inputPort : inputPorts)
+        {
+            // Ports handed over to another listener (e.g. a reader created on the port) keep their notifications
+            const auto listener = inputPort.asPtr<IInputPortPrivate>(true).getListener();
+            if (!isSameObject(listener, functionBlock))
+                continue;
+
+            node.inputPorts.push_back(inputPort.asPtr<IInputPortConfig>());
+            node.inputPortListeners.push_back(listener);
+        }
+
+        if (node.inputPorts.empty())
+            continue;
+
+        nodeIndices.emplace(functionBlock.getGlobalId().toStdString(), nodes.size());
+        nodes.push_back(std::move(node));
+    }
+
+    if (nodes.empty())
+        return;
+
+    // Link every function block to the function blocks owning the signals connected to its input ports
+    for (size_t i = 0; i < nodes.size(); ++i)
+    {
+        auto& node = nodes[i];
+        for (const auto& inputPort : node.inputPorts)
+        {
+            const auto signal = inputPort.getSignal();
+
+            size_t owner = nodes.size();
+            for (ComponentPtr component = signal.assigned() ? signal.getParent() : nullptr; component.assigned();
+                 component = component.getParent())
+            {
+                const auto it = nodeIndices.find(component.getGlobalId().toStdString());
+                if (it != nodeIndices.end())
+                {
+                    owner = it->second;
+                    break;
+                }
+            }
+
+            const bool external = owner == nodes.size() || owner == i;
+            node.inputPortsExternal.push_back(external);
+            if (external)
+                continue;
+
+            auto& successors = nodes[owner].successors;
+            if (std::find(successors.begin(), successors.end(), i) == successors.end())
+            {
+                successors.push_back(i);
+                ++node.predecessorCount;
+            }
+        }
+    }
+
+    std::vector<size_t> order;
+    std::vector<size_t> pending(nodes.size());
+    for (size_t i = 0; i < nodes.size(); ++i)
+    {
+        pending[i] = nodes[i].predecessorCount;
+        if (pending[i] == 0)
+            order.push_back(i);
+    }
+
+    for (size_t i = 0; i < order.size(); ++i)
+    {
+        for (const auto successor : nodes[order[i]].successors)
+        {
+            if (--pending[successor] == 0)
+                order.push_back(successor);
+        }
+    }
+
+    if (order.size() != nodes.size())
+        throw InvalidStateException("Function block connections form a cycle");
+
+    const std::weak_ptr<FunctionBlockGraphState> stateRef = state;
+
+    auto graph = TaskGraph("FunctionBlockGraph");
+    auto endTask = Task(Procedure([stateRef]
+                        {
+                            const auto graphState = stateRef.lock();
+                            if (graphState)
+                                finishRun(graphState);
+                        }),
+                        "End");
+
+    std::vector<TaskPtr> tasks;
+    tasks.reserve(nodes.size());
+    for (const auto& node : nodes)
+        tasks.push_back(Task(createNodeWork(node, state->loggerComponent), node.functionBlock.getGlobalId()));
+
+    // Tasks are linked in topological order so that every task is part of the graph before it gets continuations
+    for (const auto i : order)
+    {
+        const auto& node = nodes[i];
+        if (node.predecessorCount == 0)
+            graph.then(tasks[i]);
+
+        for (const auto successor : node.successors)
+            tasks[i].then(tasks[successor]);
+
+        if (node.successors.empty())
+            tasks[i].then(endTask);
+    }
+
+    for (const auto& node : nodes)
+    {
+        for (size_t i = 0; i < node.inputPorts.size(); ++i)
+        {
+            const auto& inputPort = node.inputPorts[i];
+            const auto& listener = node.inputPortListeners[i];
+            const auto redirect = createWithImplementation<IInputPortNotifications, FunctionBlockGraphPortListener>(
+                listener, stateRef, node.inputPortsExternal[i] ? FunctionBlockGraphPendingFlag() : node.pending);
+
+            inputPort.setListener(redirect);
+            state->ports.push_back({inputPort, listener, redirect});
+        }
+
+        state->pendingFlags.push_back(node.pending);
+    }
+
+    state->graph = graph;
+    state->functionBlockCount = nodes.size();
+
+    LOG_D("Built function block graph with {} function blocks", nodes.size());
+}
+
+void FunctionBlockGraph::clear()
+{
+    std::vector<AwaitablePtr> runs;
+    {
+        std::scoped_lock lock(state->sync);
+        retireGraph(*state);
+
+        for (const auto& retired : state->retiredGraphs)
+            runs.push_back(retired.second);
+    }
+
+    for (const auto& run : runs)
+    {
+        if (run.assigned())
+            run.wait();
+    }
+}
+
+void FunctionBlockGraph::execute()
+{
+    AwaitablePtr run;
+    {
+        std::scoped_lock lock(state->sync);
+        if (!state->graph.assigned())
+            return;
+
+        pruneRetiredGraphs(*state);
+        setPending(*state, true);
+        try
+        {
+            run = state->scheduler.scheduleGraph(state->graph);
+        }
+        catch (...)
+        {
+            setPending(*state, false);
+            throw;
+        }
+        state->lastRun = run;
+    }
+
+    run.wait();
+}
+
+SizeT FunctionBlockGraph::getFunctionBlockCount() const
+{
+    std::scoped_lock lock(state->sync);
+    return state->functionBlockCount;
+}
+
+END_NAMESPACE_OPENDAQ
@@ -0,0 +1,249 @@
+#include <opendaq/function_block_graph.h>
+#include <opendaq/function_block_impl.h>
+#include <opendaq/function_block_ptr.h>
+#include <opendaq/context_factory.h>
+#include <opendaq/event_packet_ptr.h>
+#include <opendaq/folder_factory.h>
+#include <opendaq/input_port_private_ptr.h>
+#include <opendaq/packet_factory.h>
+#include <opendaq/scheduler_factory.h>
+#include <opendaq/signal_factory.h>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+
+using namespace daq;
+
+using FunctionBlockGraphTest = testing::Test;
+
+class GraphTestListenerImpl final : public ImplementationOf<IInputPortNotifications>
+{
+public:
+    ErrCode INTERFACE_FUNC acceptsSignal(IInputPort* /*port*/, ISignal* /*signal*/, Bool* accept) override
+    {
+        *accept = True;
+        return OPENDAQ_SUCCESS;
+    }
+
+    ErrCode INTERFACE_FUNC connected(IInputPort* /*port*/) override
+    {
+        return OPENDAQ_SUCCESS;
+    }
+
+    ErrCode INTERFACE_FUNC disconnected(IInputPort* /*port*/) override
+    {
+        return OPENDAQ_SUCCESS;
+    }
+
+    ErrCode INTERFACE_FUNC packetReceived(IInputPort* port) override
+    {
+        const auto connection = InputPortPtr::Borrow(port).getConnection();
+        while (connection.dequeue().assigned())
+            ++packetCount;
+
+        return OPENDAQ_SUCCESS;
+    }
+
+    std::atomic<Int> packetCount{0};
+};
+
+class GraphTestFbImpl final : public FunctionBlock
+{
+public:
+    GraphTestFbImpl(const ContextPtr& ctx, const ComponentPtr& parent, const StringPtr& localId, std::atomic<Int>* sequence)
+        : FunctionBlock(FunctionBlockType("test_uid", "test_name", "test_description"), ctx, parent, localId)
+        , sequence(sequence)
+    {
+        outputSignal = createAndAddSignal("out");
+        createAndAddInputPort("in", PacketReadyNotification::SameThread);
+    }
+
+    void onPacketReceived(const InputPortPtr& port) override
+    {
+        const auto connection = port.getConnection();
+        for (auto packet = connection.dequeue(); packet.assigned(); packet = connection.dequeue())
+        {
+            ++packetCount;
+
+            // Only test packets are forwarded, so connecting the function blocks in a cycle doesn't recurse
+            const auto eventPacket = packet.asPtrOrNull<IEventPacket>();
+            if (eventPacket.assigned() && eventPacket.getEventId() == "Test")
+                outputSignal.sendPacket(EventPacket("Test", Dict<IString, IBaseObject>()));
+        }
+
+        lastThreadId = std::this_thread::get_id();
+        lastSequence = ++(*sequence);
+    }
+
+    SignalConfigPtr outputSignal;
+    std::atomic<Int>* sequence;
+    std::atomic<Int> packetCount{0};
+    std::atomic<Int> lastSequence{0};
+    std::thread::id lastThreadId;
+};
+
+class FunctionBlockGraphFixture : public FunctionBlockGraphTest
+{
+protected:
+    void SetUp() override
+    {
+        logger = Logger();
+        scheduler = Scheduler(logger, 4);
+        context = Context(scheduler, logger, TypeManager(), nullptr);
+        root = Folder(context, nullptr, "root");
+        source = Signal(context, root, "source");
+    }
+
+    void TearDown() override
+    {
+        scheduler.stop();
+    }
+
+    FunctionBlockPtr addFunctionBlock(const std::string& localId)
+    {
+        auto fb = createWithImplementation<IFunctionBlock, GraphTestFbImpl>(context, root, localId, &sequence);
+        root.addItem(fb);
+        return fb;
+    }
+
+    static GraphTestFbImpl& impl(const FunctionBlockPtr& fb)
+    {
+        return *dynamic_cast<GraphTestFbImpl*>(fb.getObject());
+    }
+
+    static InputPortPtr inputPort(const FunctionBlockPtr& fb)
+    {
+        return fb.getInputPorts()[0];
+    }
+
+    std::atomic<Int> sequence{0};
+    LoggerPtr logger;
+    SchedulerPtr scheduler;
+    ContextPtr context;
+    FolderConfigPtr root;
+    SignalConfigPtr source;
+};
+
+TEST_F(FunctionBlockGraphFixture, ProcessesChainsInTopologicalOrder)
+{
+    const auto first = addFunctionBlock("first");
+    const auto second = addFunctionBlock("second");
+    const auto independent = addFunctionBlock("independent");
+
+    inputPort(first).connect(source);
+    inputPort(second).connect(first.getSignals()[0]);
+    inputPort(independent).connect(source);
+
+    FunctionBlockGraph graph(scheduler, logger);
+    graph.build(root);
+    ASSERT_EQ(graph.getFunctionBlockCount(), 3u);
+
+    for (const auto& fb : {first, second, independent})
+        impl(fb).packetCount = 0;
+
+    source.sendPacket(EventPacket("Test", Dict<IString, IBaseObject>()));
+    scheduler.waitAll();
+
+    ASSERT_EQ(impl(first).packetCount, 1);
+    ASSERT_EQ(impl(second).packetCount, 1);
+    ASSERT_EQ(impl(independent).packetCount, 1);
+    ASSERT_LT(impl(first).lastSequence, impl(second).lastSequence);
+    ASSERT_NE(impl(first).lastThreadId, std::this_thread::get_id());
+
+    // Explicit runs only process function blocks with queued packets
+    graph.execute();
+    ASSERT_EQ(impl(second).packetCount, 1);
+}
+
+TEST_F(FunctionBlockGraphFixture, ClearRestoresInlineProcessing)
+{
+    const auto fb = addFunctionBlock("fb");
+    inputPort(fb).connect(source);
+
+    FunctionBlockGraph graph(scheduler, logger);
+    graph.build(root);
+    graph.clear();
+    ASSERT_EQ(graph.getFunctionBlockCount(), 0u);
+
+    impl(fb).packetCount = 0;
+    source.sendPacket(EventPacket("Test", Dict<IString, IBaseObject>()));
+
+    ASSERT_EQ(impl(fb).packetCount, 1);
+    ASSERT_EQ(impl(fb).lastThreadId, std::this_thread::get_id());
+}
+
+TEST_F(FunctionBlockGraphFixture, CycleThrows)
+{
+    const auto first = addFunctionBlock("first");
+    const auto second = addFunctionBlock("second");
+
+    inputPort(first).connect(second.getSignals()[0]);
+    inputPort(second).connect(first.getSignals()[0]);
+
+    FunctionBlockGraph graph(scheduler, logger);
+    ASSERT_THROW(graph.build(root), InvalidStateException);
+    ASSERT_EQ(graph.getFunctionBlockCount(), 0u);
+}
+
+TEST_F(FunctionBlockGraphFixture, ProcessesPacketsSentOutsideOfRun)
+{
+    const auto first = addFunctionBlock("first");
+    const auto second = addFunctionBlock("second");
+
+    inputPort(first).connect(source);
+    inputPort(second).connect(first.getSignals()[0]);
+
+    FunctionBlockGraph graph(scheduler, logger);
+    graph.build(root);
+    impl(second).packetCount = 0;
+
+    // Sent by the upstream function block from its own thread rather than from the graph run
+    impl(first).outputSignal.sendPacket(EventPacket("Test", Dict<IString, IBaseObject>()));
+    scheduler.waitAll();
+
+    ASSERT_EQ(impl(second).packetCount, 1);
+    ASSERT_NE(impl(second).lastThreadId, std::this_thread::get_id());
+}
+
+TEST_F(FunctionBlockGraphFixture, KeepsListenersOfOtherObjects)
+{
+    const auto fb = addFunctionBlock("fb");
+    const auto port = inputPort(fb);
+    port.connect(source);
+
+    const auto listenerObj = createWithImplementation<IInputPortNotifications, GraphTestListenerImpl>();
+    auto& listener = *dynamic_cast<GraphTestListenerImpl*>(listenerObj.getObject());
+    port.asPtr<IInputPortConfig>().setListener(listenerObj);
+
+    FunctionBlockGraph graph(scheduler, logger);
+    graph.build(root);
+    ASSERT_EQ(graph.getFunctionBlockCount(), 0u);
+
+    impl(fb).packetCount = 0;
+    source.sendPacket(EventPacket("Test", Dict<IString, IBaseObject>()));
+    scheduler.waitAll();
+
+    ASSERT_EQ(listener.packetCount, 1);
+    ASSERT_EQ(impl(fb).packetCount, 0);
+
+    graph.clear();
+    ASSERT_EQ(port.asPtr<IInputPortPrivate>().getListener(), listenerObj);
+}
+
+TEST_F(FunctionBlockGraphFixture, ClearKeepsListenersSetAfterBuild)
+{
+    const auto fb = addFunctionBlock("fb");
+    const auto port = inputPort(fb);
+    port.connect(source);
+
+    FunctionBlockGraph graph(scheduler, logger);
+    graph.build(root);
+    ASSERT_EQ(graph.getFunctionBlockCount(), 1u);
+
+    const auto listenerObj = createWithImplementation<IInputPortNotifications, GraphTestListenerImpl>();
+    port.asPtr<IInputPortConfig>().setListener(listenerObj);
+
+    graph.build(root);
+    ASSERT_EQ(graph.getFunctionBlockCount(), 0u);
+    ASSERT_EQ(port.asPtr<IInputPortPrivate>().getListener(), listenerObj);
+}
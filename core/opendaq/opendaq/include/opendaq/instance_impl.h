@@ -21,6 +21,8 @@
 #include <opendaq/context_ptr.h>
 #include <opendaq/module_manager_ptr.h>
 #include <opendaq/function_block_ptr.h>
+#include <opendaq/function_block_graph.h>
+#include <coreobjects/core_event_args_ptr.h>
 
 BEGIN_NAMESPACE_OPENDAQ
 
@@ -153,7 +155,12 @@ private:
 
     bool rootDeviceSet;
 
+    std::unique_ptr<FunctionBlockGraph> functionBlockGraph;
+
     void stopServers();
+    void enableFunctionBlockGraph(const DictPtr<IString, IBaseObject>& options);
+    void rebuildFunctionBlockGraph();
+    void functionBlockGraphCoreEventCallback(ComponentPtr& component, CoreEventArgsPtr& eventArgs);
     DevicePtr createDevice(const StringPtr& connectionString, const PropertyObjectPtr& config = nullptr);
 
     template<class F>
@@ -55,6 +55,7 @@
 #include <opendaq/data_descriptor_factory.h>
 
 #include <opendaq/packet_factory.h>
+#include <opendaq/packet_recycler_factory.h>
 
 #include <opendaq/dimension_factory.h>
 #include <opendaq/range_factory.h>
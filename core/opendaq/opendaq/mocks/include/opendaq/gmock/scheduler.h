@@ -33,4 +33,5 @@ struct MockScheduler : daq::ImplementationOf<daq::IScheduler>
     MOCK_METHOD(daq::ErrCode, stop, (), (override MOCK_CALL));
     MOCK_METHOD(daq::ErrCode, waitAll, (), (override MOCK_CALL));
     MOCK_METHOD(daq::ErrCode, isMultiThreaded, (daq::Bool* multiThreaded), (override MOCK_CALL));
+    MOCK_METHOD(daq::ErrCode, getWorkerCount, (daq::SizeT* count), (override MOCK_CALL));
 };
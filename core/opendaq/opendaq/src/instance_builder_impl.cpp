@@ -15,7 +15,8 @@ DictPtr<IString, IBaseObject> InstanceBuilderImpl::GetDefaultOptions()
                 {"ModulesPath", ""}
             })},
         {"Scheduler", Dict<IString, IBaseObject>({
-                {"WorkersNum", 0}
+                {"WorkersNum", 0},
+                {"FunctionBlockGraph", false}
             })},
         {"Logging", Dict<IString, IBaseObject>({
                 {"GlobalLogLevel", OPENDAQ_LOG_LEVEL_DEFAULT}
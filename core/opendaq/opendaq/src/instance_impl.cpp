@@ -54,10 +54,17 @@ InstanceImpl::InstanceImpl(IInstanceBuilder* instanceBuilder)
         rootDevice = Client(this->context, instanceId, builderPtr.getDefaultRootDeviceInfo());
 
     rootDevice.asPtrOrNull<IPropertyObjectInternal>().enableCoreEventTrigger();
+    enableFunctionBlockGraph(builderPtr.getOptions());
 }
 
 InstanceImpl::~InstanceImpl()
 {
+    if (functionBlockGraph)
+    {
+        context.getOnCoreEvent() -= event(&InstanceImpl::functionBlockGraphCoreEventCallback);
+        functionBlockGraph.reset();
+    }
+
     stopServers();
     rootDevice.release();
 }
@@ -114,6 +121,53 @@ static ContextPtr contextFromInstanceBuilder(IInstanceBuilder* instanceBuilder)
     return Context(scheduler, logger, typeManager, moduleManager, options);
 }
 
+void InstanceImpl::enableFunctionBlockGraph(const DictPtr<IString, IBaseObject>& options)
+{
+    if (!options.hasKey("Scheduler"))
+        return;
+
+    const DictPtr<IString, IBaseObject> schedulerOptions = options.get("Scheduler");
+    if (!schedulerOptions.hasKey("FunctionBlockGraph"))
+        return;
+
+    const auto value = schedulerOptions.get("FunctionBlockGraph");
+    if (value.getCoreType() != CoreType::ctBool || !static_cast<bool>(value))
+        return;
+
+    functionBlockGraph = std::make_unique<FunctionBlockGraph>(context.getScheduler(), context.getLogger());
+    context.getOnCoreEvent() += event(&InstanceImpl::functionBlockGraphCoreEventCallback);
+    rebuildFunctionBlockGraph();
+
+    LOG_I("Function blocks are processed as a task graph on the scheduler");
+}
+
+void InstanceImpl::rebuildFunctionBlockGraph()
+{
+    try
+    {
+        functionBlockGraph->build(rootDevice);
+    }
+    catch (const std::exception& e)
+    {
+        LOG_W("Function blocks fall back to per-port notifications: {}", e.what());
+    }
+}
+
+void InstanceImpl::functionBlockGraphCoreEventCallback(ComponentPtr& /*component*/, CoreEventArgsPtr& eventArgs)
+{
+    switch (static_cast<CoreEventId>(eventArgs.getEventId()))
+    {
+        case CoreEventId::ComponentAdded:
+        case CoreEventId::ComponentRemoved:
+        case CoreEventId::SignalConnected:
+        case CoreEventId::SignalDisconnected:
+            rebuildFunctionBlockGraph();
+            break;
+        default:
+            break;
+    }
+}
+
 void InstanceImpl::stopServers()
 {
     for (const auto& server : servers)
@@ -303,6 +357,10 @@ ErrCode InstanceImpl::setRootDevice(IString* connectionString, IPropertyObject*
     LOG_I("Root device explicitly set to {}", connectionStringPtr);
 
     this->rootDevice.asPtrOrNull<IPropertyObjectInternal>().enableCoreEventTrigger();
+
+    if (functionBlockGraph)
+        rebuildFunctionBlockGraph();
+
     return OPENDAQ_SUCCESS;
 }
 
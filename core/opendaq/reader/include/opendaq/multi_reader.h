@@ -179,7 +179,8 @@ OPENDAQ_DECLARE_CLASS_FACTORY_WITH_INTERFACE(
     SampleType, domainReadType,
     ReadMode, mode,
     ReadTimeoutType, timeoutType,
-    Bool, startOnFullUnitOfDomain)
+    Bool, startOnFullUnitOfDomain,
+    SizeT, parallelReadThreshold)
 
 OPENDAQ_DECLARE_CLASS_FACTORY_WITH_INTERFACE(
     LIBRARY_FACTORY, MultiReaderFromExisting, IMultiReader,
@@ -17,6 +17,7 @@
 #include <opendaq/multi_reader.h>
 #include <opendaq/read_info.h>
 #include <opendaq/reader_config_ptr.h>
+#include <opendaq/scheduler_ptr.h>
 #include <opendaq/signal_reader.h>
 #include <coreobjects/property_object_factory.h>
 
@@ -30,7 +31,8 @@ public:
                     SampleType domainReadType,
                     ReadMode mode,
                     ReadTimeoutType timeoutType,
-                    Bool startOnFullUnitOfDomain = false);
+                    Bool startOnFullUnitOfDomain = false,
+                    SizeT parallelReadThreshold = 0);
 
     MultiReaderImpl(MultiReaderImpl* old,
                     SampleType valueReadType,
@@ -102,6 +104,8 @@ private:
     [[nodiscard]] Duration durationFromStart() const;
 
     void readSamples(SizeT samples);
+    void readSignals(SizeT begin, SizeT end);
+    void readSignalsInParallel();
 
     void readDomainStart();
     void sync();
@@ -129,6 +133,14 @@ private:
     LoggerComponentPtr loggerComponent;
 
     bool startOnFullUnitOfDomain;
+    ReadTimeoutType timeoutType{ReadTimeoutType::All};
+
+    // Reads copying at least this many samples across all signals are split among the scheduler workers
+    SizeT parallelReadThreshold{0};
+    SchedulerPtr scheduler;
+
+    // Signalled from packetReceived so read waits for new packets instead of polling
+    NotifyInfo notify{};
 };
 
 END_NAMESPACE_OPENDAQ
@@ -18,6 +18,8 @@
 #include <opendaq/block_reader_ptr.h>
 #include <opendaq/tail_reader_ptr.h>
 #include <opendaq/packet_reader_ptr.h>
+#include <opendaq/span_reader_ptr.h>
+#include <opendaq/sample_span_ptr.h>
 #include <opendaq/context_ptr.h>
 #include <opendaq/input_port_ptr.h>
 #include <opendaq/multi_reader_ptr.h>
@@ -53,6 +55,49 @@ inline PacketReaderPtr PacketReaderFromPort(InputPortConfigPtr port)
     return PacketReaderFromPort_Create(port);
 }
 
+/*!
+ * @brief Creates a reader that returns references to the sample buffers of the signal packets instead of copying the samples.
+ * @param signal The signal to read the samples from.
+ * @param mode Determines whether the spans reference the raw or the scaled packet data.
+ * @param timeoutType How to handle the read timeout.
+ */
+inline SpanReaderPtr SpanReader(SignalPtr signal,
+                                ReadMode mode = ReadMode::Scaled,
+                                ReadTimeoutType timeoutType = ReadTimeoutType::All)
+{
+    return SpanReader_Create(signal, mode, timeoutType);
+}
+
+/*!
+ * @brief Creates a reader that returns references to the sample buffers of the port packets instead of copying the samples.
+ * @param port The input port to read the samples from.
+ * @param mode Determines whether the spans reference the raw or the scaled packet data.
+ * @param timeoutType How to handle the read timeout.
+ */
+inline SpanReaderPtr SpanReaderFromPort(InputPortConfigPtr port,
+                                        ReadMode mode = ReadMode::Scaled,
+                                        ReadTimeoutType timeoutType = ReadTimeoutType::All)
+{
+    return SpanReaderFromPort_Create(port, mode, timeoutType);
+}
+
+/*!
+ * @brief Creates a span of samples inside a Data packet.
+ * @param packet The packet that holds the samples.
+ * @param sampleIndex The index of the first sample of the span in the packet.
+ * @param sampleCount The number of samples in the span.
+ * @param rawData If true, the span references the raw packet data instead of the scaled data.
+ * @param domainStart The domain value of the first sample or @c nullptr if not known.
+ */
+inline SampleSpanPtr SampleSpan(const DataPacketPtr& packet,
+                                SizeT sampleIndex,
+                                SizeT sampleCount,
+                                Bool rawData = false,
+                                const NumberPtr& domainStart = nullptr)
+{
+    return SampleSpan_Create(packet, sampleIndex, sampleCount, rawData, domainStart);
+}
+
 /*!
  * @brief Creates a signal data reader that abstracts away reading of signal packets by keeping an
  * internal read-position and automatically advances it on subsequent reads.
@@ -246,6 +291,51 @@ inline TailReaderPtr TailReader(SignalPtr signal, SizeT historySize, ReadMode mo
     return TailReader<>(std::move(signal), historySize, mode);
 }
 
+/*!
+ * @brief A reader that only ever reads the last N samples, subsequent calls may result in overlapping data.
+ * @param signal The signal to read the data from.
+ * @param historySize The maximum amount of samples in history to keep.
+ * @param valueReadType The sample-type type to read signal values as. Implicitly convert from actual type to
+ * this one if conversion exists.
+ * @param domainReadType The sample-type type to read signal domain as. Implicitly convert from actual type to
+ * this one if conversion exists.
+ * @param ringBuffer When @c true, the samples are converted to the read types as they are received and kept in
+ * a preallocated buffer of @p historySize samples instead of keeping the packets. Reads are then at most two
+ * memory copies. Samples received before a descriptor change are discarded with it.
+ */
+inline TailReaderPtr TailReaderEx(SignalPtr signal,
+                                  SizeT historySize,
+                                  SampleType valueReadType,
+                                  SampleType domainReadType,
+                                  ReadMode mode = ReadMode::Scaled,
+                                  bool ringBuffer = false)
+{
+    return TailReaderEx_Create(signal, historySize, valueReadType, domainReadType, mode, ringBuffer);
+}
+
+/*!
+ * @brief A reader that only ever reads the last N samples, subsequent calls may result in overlapping data.
+ * @param signal The signal to read the data from.
+ * @param historySize The maximum amount of samples in history to keep.
+ * @param ringBuffer When @c true, the samples are kept in a preallocated buffer of @p historySize samples.
+ * @tparam TValueType The sample-type type to read signal values as. Implicitly convert from actual type to
+ * this one if conversion exists.
+ * @tparam TDomainType The sample-type type to read signal domain as. Implicitly convert from actual type to
+ * this one if conversion exists.
+ */
+template <typename TValueType = double, typename TDomainType = ClockTick>
+TailReaderPtr TailReaderEx(SignalPtr signal, SizeT historySize, bool ringBuffer, ReadMode mode = ReadMode::Scaled)
+{
+    return TailReaderEx(
+        signal,
+        historySize,
+        SampleTypeFromType<TValueType>::SampleType,
+        SampleTypeFromType<TDomainType>::SampleType,
+        mode,
+        ringBuffer
+    );
+}
+
 /*!
  * @brief Creates a new reader using the data of the existing one.
  * Used when a TailReader gets invalidated because of incompatible change in the signal descriptor.
@@ -367,14 +457,23 @@ inline MultiReaderPtr MultiReaderFromPort(ListPtr<IInputPortConfig> ports,
     return MultiReader_Create(ports, valueReadType, domainReadType, mode, timeoutType);
 }
 
+/*!
+ * @brief Creates a Multi reader with extended options.
+ * @param parallelReadThreshold The minimum number of samples a read copies across all signals for the signals
+ * to be read in parallel on the workers of the context's Scheduler. Set to 0 to always read on the calling thread.
+ * Parallel reads block the calling thread until the workers finish, so they should not be used by readers that
+ * are read on a Scheduler worker.
+ */
 inline MultiReaderPtr MultiReaderEx(const ListPtr<ISignal>& signals,
                                     SampleType valueReadType,
                                     SampleType domainReadType,
                                     ReadMode mode = ReadMode::Scaled,
                                     ReadTimeoutType timeoutType = ReadTimeoutType::All,
-                                    bool startOnFullUnitOfDomain = false)
+                                    bool startOnFullUnitOfDomain = false,
+                                    SizeT parallelReadThreshold = 0)
 {
-    return MultiReaderEx_Create(signals, valueReadType, domainReadType, mode, timeoutType, startOnFullUnitOfDomain);
+    return MultiReaderEx_Create(
+        signals, valueReadType, domainReadType, mode, timeoutType, startOnFullUnitOfDomain, parallelReadThreshold);
 }
 
 inline MultiReaderPtr MultiReaderFromExisting(const MultiReaderPtr& invalidatedReader, SampleType valueReadType, SampleType domainReadType)
@@ -403,10 +502,18 @@ inline MultiReaderPtr MultiReaderFromPort(ListPtr<IInputPortConfig> ports,
 }
 
 template <typename TValueType = double, typename TDomainType = ClockTick>
-MultiReaderPtr MultiReaderEx(ListPtr<ISignal> signals, ReadTimeoutType timeoutType = ReadTimeoutType::All, bool startOnFullUnitOfDomain = false)
-{
-    return MultiReaderEx(
-        signals, SampleTypeFromType<TValueType>::SampleType, SampleTypeFromType<TDomainType>::SampleType, ReadMode::Scaled, timeoutType, startOnFullUnitOfDomain);
+MultiReaderPtr MultiReaderEx(ListPtr<ISignal> signals,
+                             ReadTimeoutType timeoutType = ReadTimeoutType::All,
+                             bool startOnFullUnitOfDomain = false,
+                             SizeT parallelReadThreshold = 0)
+{
+    return MultiReaderEx(signals,
+                         SampleTypeFromType<TValueType>::SampleType,
+                         SampleTypeFromType<TDomainType>::SampleType,
+                         ReadMode::Scaled,
+                         timeoutType,
+                         startOnFullUnitOfDomain,
+                         parallelReadThreshold);
 }
 
 template <typename TValueType = double, typename TDomainType = ClockTick>
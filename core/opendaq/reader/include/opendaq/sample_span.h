@@ -0,0 +1,76 @@
+/*
+ * Copyright 2022-2023 Blueberry d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+#include <opendaq/data_packet.h>
+#include <coretypes/number.h>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @ingroup opendaq_readers
+ * @addtogroup opendaq_span_reader Span reader
+ * @{
+ */
+
+/*#
+ * [interfaceSmartPtr(IDataPacket, DataPacketPtr, "<opendaq/data_packet_ptr.h>")]
+ */
+
+/*!
+ * @brief A contiguous block of samples inside the buffer of a Data packet.
+ *
+ * The span holds a reference to its packet, so the data stays valid for as long as the span is alive.
+ * The data must only be read. Its layout is described by the Data descriptor of the packet.
+ */
+DECLARE_OPENDAQ_INTERFACE(ISampleSpan, IBaseObject)
+{
+    /*!
+     * @brief Gets the address of the first sample of the span.
+     * @param[out] data The address of the first sample.
+     */
+    virtual ErrCode INTERFACE_FUNC getData(void** data) = 0;
+
+    /*!
+     * @brief Gets the number of samples in the span.
+     * @param[out] count The number of samples.
+     */
+    virtual ErrCode INTERFACE_FUNC getSampleCount(SizeT* count) = 0;
+
+    /*!
+     * @brief Gets the domain value of the first sample of the span in ticks of the domain Data descriptor.
+     * @param[out] start The domain value of the first sample or @c nullptr if the packet has no domain packet
+     * or its domain values are not integers.
+     */
+    virtual ErrCode INTERFACE_FUNC getDomainStart(INumber** start) = 0;
+
+    /*!
+     * @brief Gets the Data packet that holds the samples of the span.
+     * @param[out] packet The Data packet.
+     */
+    virtual ErrCode INTERFACE_FUNC getPacket(IDataPacket** packet) = 0;
+};
+/*!@}*/
+
+OPENDAQ_DECLARE_CLASS_FACTORY(
+    LIBRARY_FACTORY, SampleSpan,
+    IDataPacket*, packet,
+    SizeT, sampleIndex,
+    SizeT, sampleCount,
+    Bool, rawData,
+    INumber*, domainStart
+)
+
+END_NAMESPACE_OPENDAQ
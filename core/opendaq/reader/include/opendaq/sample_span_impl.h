@@ -0,0 +1,43 @@
+/*
+ * Copyright 2022-2023 Blueberry d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+#include <opendaq/sample_span.h>
+#include <opendaq/data_packet_ptr.h>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+class SampleSpanImpl final : public ImplementationOf<ISampleSpan>
+{
+public:
+    explicit SampleSpanImpl(const DataPacketPtr& packet,
+                            SizeT sampleIndex,
+                            SizeT sampleCount,
+                            Bool rawData,
+                            const NumberPtr& domainStart);
+
+    ErrCode INTERFACE_FUNC getData(void** data) override;
+    ErrCode INTERFACE_FUNC getSampleCount(SizeT* count) override;
+    ErrCode INTERFACE_FUNC getDomainStart(INumber** start) override;
+    ErrCode INTERFACE_FUNC getPacket(IDataPacket** packet) override;
+
+private:
+    DataPacketPtr packet;
+    void* data;
+    SizeT sampleCount;
+    NumberPtr domainStart;
+};
+
+END_NAMESPACE_OPENDAQ
@@ -0,0 +1,84 @@
+/*
+ * Copyright 2022-2023 Blueberry d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+#include <opendaq/reader.h>
+#include <opendaq/reader_status.h>
+#include <opendaq/sample_reader.h>
+#include <opendaq/sample_span.h>
+#include <opendaq/signal.h>
+#include <opendaq/input_port_config.h>
+#include <coretypes/listobject.h>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*#
+ * [include(IReader)]
+ * [interfaceSmartPtr(IReader, GenericReaderPtr)]
+ */
+
+/*!
+ * @ingroup opendaq_readers
+ * @addtogroup opendaq_span_reader Span reader
+ * @{
+ */
+
+/*!
+ * @brief A signal data reader that returns references to the sample buffers of the received packets
+ * instead of copying the samples.
+ *
+ * Like the Stream reader, it keeps an internal read-position that advances on subsequent reads. Each read
+ * returns a list of Sample spans, one per packet the read samples are taken from. The spans keep their packets
+ * alive and reference the raw packet data in Unscaled mode and the scaled packet data in Scaled mode. The samples
+ * are returned in the sample-type of the signal, so a descriptor change never invalidates the reader.
+ */
+DECLARE_OPENDAQ_INTERFACE(ISpanReader, IReader)
+{
+    // [elementType(spans, ISampleSpan)]
+    /*!
+     * @brief Returns spans referencing at maximum the next `count` unread samples.
+     * @param[out] spans The spans of the read samples in stream order.
+     * @param[in,out] count The maximum amount of samples to be read. Set to the amount actually read.
+     * @param timeoutMs The maximum amount of time in milliseconds to wait for the requested amount of samples before returning.
+     * @param[out] status Represents the status of the reader.
+     * - If an event packet was encountered during processing, IReaderStatus::getReadStatus returns ReadStatus::Event.
+     *   The spans read before the event are returned.
+     * - If the reading process is successful, IReaderStatus::getReadStatus returns ReadStatus::Ok.
+     */
+    virtual ErrCode INTERFACE_FUNC read(IList** spans, SizeT* count, SizeT timeoutMs = 0, IReaderStatus** status = nullptr) = 0;
+
+    /*!
+     * @brief Gets the reader's read mode which determines if the spans reference the raw or the scaled packet data.
+     * @param[out] mode The mode the reader is in (either Unscaled or Scaled).
+     */
+    virtual ErrCode INTERFACE_FUNC getReadMode(ReadMode* mode) = 0;
+};
+/*!@}*/
+
+OPENDAQ_DECLARE_CLASS_FACTORY(
+    LIBRARY_FACTORY, SpanReader,
+    ISignal*, signal,
+    ReadMode, mode,
+    ReadTimeoutType, timeoutType
+)
+
+OPENDAQ_DECLARE_CLASS_FACTORY_WITH_INTERFACE(
+    LIBRARY_FACTORY, SpanReaderFromPort, ISpanReader,
+    IInputPortConfig*, port,
+    ReadMode, mode,
+    ReadTimeoutType, timeoutType
+)
+
+END_NAMESPACE_OPENDAQ
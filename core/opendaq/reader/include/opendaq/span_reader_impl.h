@@ -0,0 +1,76 @@
+/*
+ * Copyright 2022-2023 Blueberry d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+#include <opendaq/span_reader.h>
+#include <opendaq/connection_ptr.h>
+#include <opendaq/data_packet_ptr.h>
+#include <opendaq/event_packet_ptr.h>
+#include <opendaq/input_port_config_ptr.h>
+#include <opendaq/read_info.h>
+#include <opendaq/sample_span_ptr.h>
+#include <opendaq/typed_reader.h>
+#include <coreobjects/property_object_ptr.h>
+
+#include <mutex>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+class SpanReaderImpl final : public ImplementationOfWeak<ISpanReader, IInputPortNotifications>
+{
+public:
+    explicit SpanReaderImpl(const SignalPtr& signal, ReadMode mode, ReadTimeoutType timeoutType);
+    explicit SpanReaderImpl(IInputPortConfig* port, ReadMode mode, ReadTimeoutType timeoutType);
+    ~SpanReaderImpl() override;
+
+    // IReader
+    ErrCode INTERFACE_FUNC getAvailableCount(SizeT* count) override;
+    ErrCode INTERFACE_FUNC setOnDataAvailable(IProcedure* callback) override;
+
+    // ISpanReader
+    ErrCode INTERFACE_FUNC read(IList** spans, SizeT* count, SizeT timeoutMs = 0, IReaderStatus** status = nullptr) override;
+    ErrCode INTERFACE_FUNC getReadMode(ReadMode* mode) override;
+
+    // IInputPortNotifications
+    ErrCode INTERFACE_FUNC acceptsSignal(IInputPort* port, ISignal* signal, Bool* accept) override;
+    ErrCode INTERFACE_FUNC connected(IInputPort* port) override;
+    ErrCode INTERFACE_FUNC disconnected(IInputPort* port) override;
+    ErrCode INTERFACE_FUNC packetReceived(IInputPort* port) override;
+
+private:
+    void handleDescriptorChanged(const EventPacketPtr& eventPacket);
+    NumberPtr readDomainStart();
+
+    ErrCode readPackets(const ListPtr<ISampleSpan>& spans, IReaderStatus** status);
+    ErrCode readPacketData(const ListPtr<ISampleSpan>& spans);
+
+    ReadInfo info{};
+    NotifyInfo notify{};
+
+    // Converts the domain value of the first sample of a span to ticks
+    std::unique_ptr<Reader> domainReader;
+    bool domainConvertible{};
+
+    ReadMode readMode;
+    ReadTimeoutType timeoutType;
+    InputPortConfigPtr port;
+    PropertyObjectPtr portBinder;
+    ConnectionPtr connection;
+
+    std::mutex mutex;
+    ProcedurePtr readCallback;
+};
+
+END_NAMESPACE_OPENDAQ
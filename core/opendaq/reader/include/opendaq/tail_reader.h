@@ -89,6 +89,16 @@ OPENDAQ_DECLARE_CLASS_FACTORY(
     ReadMode, mode
 )
 
+OPENDAQ_DECLARE_CLASS_FACTORY_WITH_INTERFACE(
+    LIBRARY_FACTORY, TailReaderEx, ITailReader,
+    ISignal*, signal,
+    SizeT, historySize,
+    SampleType, valueReadType,
+    SampleType, domainReadType,
+    ReadMode, mode,
+    Bool, ringBuffer
+)
+
 OPENDAQ_DECLARE_CLASS_FACTORY_WITH_INTERFACE(
     LIBRARY_FACTORY, TailReaderFromPort, ITailReader,
     IInputPortConfig*, port,
@@ -18,8 +18,10 @@
 #include <opendaq/tail_reader.h>
 #include <opendaq/reader_config_ptr.h>
 #include <opendaq/data_packet_ptr.h>
+#include <opendaq/event_packet_ptr.h>
 
 #include <deque>
+#include <vector>
 
 BEGIN_NAMESPACE_OPENDAQ
 
@@ -36,7 +38,8 @@ public:
                    SizeT historySize,
                    SampleType valueReadType,
                    SampleType domainReadType,
-                   ReadMode mode);
+                   ReadMode mode,
+                   Bool ringBuffer = false);
 
     TailReaderImpl(IInputPortConfig* port,
                    SizeT historySize,
@@ -67,11 +70,28 @@ private:
     ErrCode readPacket(TailReaderInfo& info, const DataPacketPtr& packet);
     ErrCode readData(TailReaderInfo& info, IReaderStatus** status);
 
+    void handleRingBufferPacket(const PacketPtr& packet);
+    void resetRingBuffer();
+    void allocateDomainBuffer();
+    ErrCode writeRingBuffer(const DataPacketPtr& dataPacket);
+    ErrCode writeRingBuffer(Reader& reader, std::vector<uint8_t>& buffer, SizeT sampleSize, void* data, SizeT offset, SizeT position, SizeT count);
+    ErrCode readRingBuffer(TailReaderInfo& info, IReaderStatus** status);
+
 private:
     SizeT historySize;
 
     SizeT cachedSamples;
     std::deque<PacketPtr> packets;
+
+    // Ring buffer mode keeps the last historySize samples converted to the read types instead of the packets
+    bool ringBuffer{false};
+    std::vector<uint8_t> valueBuffer;
+    std::vector<uint8_t> domainBuffer;
+    SizeT valueSampleSize{};
+    SizeT domainSampleSize{};
+    SizeT ringStart{};
+    SizeT domainSamples{};
+    EventPacketPtr pendingEvent;
 };
 
 END_NAMESPACE_OPENDAQ
@@ -44,11 +44,15 @@ public:
 
     void setTransformIgnore(bool ignore);
 
+    // True if readData expects the raw packet data and applies the descriptor's post-scaling itself
+    [[nodiscard]] bool readsRawData() const noexcept;
+
 protected:
     bool ignoreTransform;
     FunctionPtr transformFunction;
     DataDescriptorPtr dataDescriptor;
     SampleType dataSampleType{SampleType::Undefined};
+    bool scaleRawData{false};
 };
 
 class UndefinedReader final : public Reader
@@ -110,9 +114,28 @@ private:
     template <typename TDataType>
     SizeT getOffsetToData(const ReaderDomainInfo& domainInfo, const Comparable& start, void* inputBuffer, SizeT size) const;
 
+    template <typename TDataType, typename TScaledType>
+    void scaleValues(const TDataType* dataStart, ReadType* dataOut, SizeT valueCount) const;
+
+    // Vectorized kernels for the data sample type, selected on descriptor change. They are stored
+    // type-erased and cast back to ConvertKernel<TDataType, ReadType> or LinearScaleKernel<TDataType, TScaledType>.
+    using ErasedKernel = void (*)();
+
+    template <typename TDataType>
+    void selectKernelsFor();
+    void selectKernels();
+
     SizeT valuesPerSample{1};
 
     SizeT rawSampleSize{0};
+
+    ErasedKernel convertKernel{nullptr};
+
+    // Linear post-scaling applied to the raw data when scaleRawData is set
+    ErasedKernel scaleKernel{nullptr};
+    SampleType scaledSampleType{SampleType::Undefined};
+    double scalingScale{1.0};
+    double scalingOffset{0.0};
 };
 
 std::unique_ptr<Reader> createReaderForType(SampleType readType, const FunctionPtr& transformFunction);
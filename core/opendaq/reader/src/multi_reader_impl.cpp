@@ -6,9 +6,10 @@
 #include <opendaq/reader_utils.h>
 #include <coreobjects/property_object_factory.h>
 #include <coreobjects/ownable_ptr.h>
+#include <opendaq/awaitable_ptr.h>
 
 #include <fmt/ostream.h>
-#include <thread>
+#include <exception>
 
 using namespace std::chrono;
 
@@ -26,13 +27,18 @@ MultiReaderImpl::MultiReaderImpl(const ListPtr<IComponent>& list,
                                  SampleType domainReadType,
                                  ReadMode mode,
                                  ReadTimeoutType timeoutType,
-                                 Bool startOnFullUnitOfDomain)
+                                 Bool startOnFullUnitOfDomain,
+                                 SizeT parallelReadThreshold)
     : startOnFullUnitOfDomain(startOnFullUnitOfDomain)
+    , timeoutType(timeoutType)
+    , parallelReadThreshold(parallelReadThreshold)
 {    
     bool isSignal = CheckPreconditions(list);
 
-    auto logger = list[0].getContext().getLogger();
-    loggerComponent = logger.getOrAddComponent("MultiReader");
+    auto context = list[0].getContext();
+    loggerComponent = context.getLogger().getOrAddComponent("MultiReader");
+    if (parallelReadThreshold != 0)
+        scheduler = context.getScheduler();
 
     this->internalAddRef();
     
@@ -59,6 +65,9 @@ MultiReaderImpl::MultiReaderImpl(MultiReaderImpl* old,
     old->invalid = true;
     portBinder = old->portBinder;
     startOnFullUnitOfDomain = old->startOnFullUnitOfDomain;
+    timeoutType = old->timeoutType;
+    parallelReadThreshold = old->parallelReadThreshold;
+    scheduler = old->scheduler;
 
     CheckPreconditions(old->getSignals());
 
@@ -80,6 +89,7 @@ MultiReaderImpl::MultiReaderImpl(const ReaderConfigPtr& readerConfig,
         throw ArgumentNullException("Existing reader must not be null");
 
     readerConfig.markAsInvalid();
+    timeoutType = readerConfig.getReadTimeoutType();
 
     SignalInfo sigInfo {
         nullptr,
@@ -592,8 +602,7 @@ ErrCode MultiReaderImpl::readPackets()
 {
     ErrCode errCode = OPENDAQ_SUCCESS;
 
-    [[maybe_unused]]
-    auto count = remainingSamplesToRead;
+    const auto count = remainingSamplesToRead;
 
     ReadInfo::Duration remainingTime = timeout.count() == 0
                                            ? 1ms
@@ -634,7 +643,8 @@ ErrCode MultiReaderImpl::readPackets()
             return errCode;
         }
 
-        if (syncStatus == SyncStatus::Synchronized && min > 0u)
+        const bool canRead = syncStatus == SyncStatus::Synchronized && min > 0u;
+        if (canRead)
         {
             auto toRead = std::min(min, remainingSamplesToRead);
 
@@ -665,7 +675,17 @@ ErrCode MultiReaderImpl::readPackets()
                 duration_cast<milliseconds>(remainingTime).count()
             );
 
-            std::this_thread::sleep_for(1ms);
+            // Don't wait for more data if we already read some
+            if (remainingSamplesToRead == 0 || (timeoutType == ReadTimeoutType::Any && remainingSamplesToRead < count))
+                break;
+
+            // Wait only if nothing could be read, packets queued behind a descriptor change are handled on the next pass
+            if (!canRead && remainingTime >= 1ms)
+            {
+                std::unique_lock notifyLock(notify.mutex);
+                notify.condition.wait_for(notifyLock, remainingTime, [this] { return notify.packetReady; });
+                notify.packetReady = false;
+            }
         }
         else if (min == 0)
         {
@@ -756,6 +776,12 @@ ErrCode MultiReaderImpl::disconnected(IInputPort* port)
 
 ErrCode MultiReaderImpl::packetReceived(IInputPort* inputPort)
 {
+    {
+        std::scoped_lock notifyLock(notify.mutex);
+        notify.packetReady = true;
+    }
+    notify.condition.notify_one();
+
     ProcedurePtr callback;
 
     {
@@ -821,12 +847,83 @@ void MultiReaderImpl::readSamples(SizeT samples)
     for (SizeT i = 0u; i < signalsNum; ++i)
     {
         signals[i].info.remainingToRead = samples;
-        signals[i].readPackets();
     }
 
+    if (scheduler.assigned() && signalsNum > 1 && samples * signalsNum >= parallelReadThreshold)
+        readSignalsInParallel();
+    else
+        readSignals(0, signalsNum);
+
     remainingSamplesToRead -= samples;
 }
 
+void MultiReaderImpl::readSignals(SizeT begin, SizeT end)
+{
+    for (SizeT i = begin; i < end; ++i)
+    {
+        signals[i].readPackets();
+    }
+}
+
+void MultiReaderImpl::readSignalsInParallel()
+{
+    // Each signal reads from its own connection into its own buffers, so the signals can be read independently
+    const SizeT signalsNum = signals.size();
+    // The calling thread reads one chunk alongside the scheduler workers
+    const SizeT chunkCount = std::min<SizeT>(signalsNum, scheduler.getWorkerCount() + 1);
+    const SizeT chunkSize = (signalsNum + chunkCount - 1) / chunkCount;
+
+    std::vector<AwaitablePtr> scheduled;
+    scheduled.reserve(chunkCount);
+
+    for (SizeT begin = chunkSize; begin < signalsNum; begin += chunkSize)
+    {
+        const SizeT end = std::min(begin + chunkSize, signalsNum);
+        try
+        {
+            scheduled.push_back(scheduler.scheduleWork([this, begin, end]
+            {
+                readSignals(begin, end);
+                return nullptr;
+            }));
+        }
+        catch (const DaqException& e)
+        {
+            LOG_W("Failed to schedule a parallel read: {}", e.what());
+            readSignals(begin, end);
+        }
+    }
+
+    std::exception_ptr error;
+
+    // The calling thread reads the first chunk while the workers read the rest
+    try
+    {
+        readSignals(0, chunkSize);
+    }
+    catch (...)
+    {
+        error = std::current_exception();
+    }
+
+    // The scheduled reads access the reader, so all of them have to finish before an error is reported
+    for (const auto& awaitable : scheduled)
+    {
+        try
+        {
+            awaitable.getResult();
+        }
+        catch (...)
+        {
+            if (!error)
+                error = std::current_exception();
+        }
+    }
+
+    if (error)
+        std::rethrow_exception(error);
+}
+
 void MultiReaderImpl::readDomainStart()
 {
     assert(getSyncStatus() != SyncStatus::Synchronized);
@@ -966,7 +1063,7 @@ ErrCode MultiReaderImpl::getReadTimeoutType(ReadTimeoutType* timeoutType)
 {
     OPENDAQ_PARAM_NOT_NULL(timeoutType);
 
-    *timeoutType = ReadTimeoutType::All;
+    *timeoutType = this->timeoutType;
     return OPENDAQ_SUCCESS;
 }
 
@@ -996,7 +1093,8 @@ OPENDAQ_DEFINE_CLASS_FACTORY_WITH_INTERFACE_AND_CREATEFUNC_OBJ(
     SampleType, domainReadType,
     ReadMode, mode,
     ReadTimeoutType, timeoutType,
-    Bool, startOnFullUnitOfDomain)
+    Bool, startOnFullUnitOfDomain,
+    SizeT, parallelReadThreshold)
 
 
 template <>
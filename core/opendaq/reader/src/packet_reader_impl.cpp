@@ -68,24 +68,8 @@ ErrCode PacketReaderImpl::readAll(IList** allPackets)
 {
     OPENDAQ_PARAM_NOT_NULL(allPackets);
 
-    ErrCode errCode = createListWithElementType(allPackets, IPacket::Id);
-    if (OPENDAQ_FAILED(errCode))
-        return errCode;
-
     std::scoped_lock lock(mutex);
-
-    SizeT size{};
-    errCode = connection->getPacketCount(&size);
-    if (OPENDAQ_FAILED(errCode))
-        return errCode;
-
-    auto readPackets = ListPtr<IPacket>::Borrow(*allPackets);
-    for (std::size_t i = 0u; i < size; ++i)
-    {
-        readPackets.pushBack(connection.dequeue());
-    }
-
-    return OPENDAQ_SUCCESS;
+    return connection->dequeueAll(allPackets);
 }
 
 ErrCode PacketReaderImpl::acceptsSignal(IInputPort* port, ISignal* signal, Bool* accept)
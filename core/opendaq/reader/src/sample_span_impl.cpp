@@ -0,0 +1,72 @@
+#include <opendaq/sample_span_impl.h>
+#include <coretypes/validation.h>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+SampleSpanImpl::SampleSpanImpl(const DataPacketPtr& packet,
+                               SizeT sampleIndex,
+                               SizeT sampleCount,
+                               Bool rawData,
+                               const NumberPtr& domainStart)
+    : packet(packet)
+    , data(nullptr)
+    , sampleCount(sampleCount)
+    , domainStart(domainStart)
+{
+    if (!packet.assigned())
+        throw ArgumentNullException("Packet must not be null.");
+
+    const SizeT packetSampleCount = packet.getSampleCount();
+    if (sampleIndex > packetSampleCount || sampleCount > packetSampleCount - sampleIndex)
+        throw OutOfRangeException("The span exceeds the packet samples.");
+
+    // Computed from the buffer size so that samples with dimensions are handled as well
+    auto buffer = static_cast<uint8_t*>(rawData ? packet.getRawData() : packet.getData());
+    const SizeT bufferSize = rawData ? packet.getRawDataSize() : packet.getDataSize();
+    const SizeT sampleSize = packetSampleCount != 0 ? bufferSize / packetSampleCount : 0;
+
+    data = buffer + sampleIndex * sampleSize;
+}
+
+ErrCode SampleSpanImpl::getData(void** data)
+{
+    OPENDAQ_PARAM_NOT_NULL(data);
+
+    *data = this->data;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode SampleSpanImpl::getSampleCount(SizeT* count)
+{
+    OPENDAQ_PARAM_NOT_NULL(count);
+
+    *count = sampleCount;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode SampleSpanImpl::getDomainStart(INumber** start)
+{
+    OPENDAQ_PARAM_NOT_NULL(start);
+
+    *start = domainStart.addRefAndReturn();
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode SampleSpanImpl::getPacket(IDataPacket** packet)
+{
+    OPENDAQ_PARAM_NOT_NULL(packet);
+
+    *packet = this->packet.addRefAndReturn();
+    return OPENDAQ_SUCCESS;
+}
+
+OPENDAQ_DEFINE_CLASS_FACTORY(
+    LIBRARY_FACTORY, SampleSpan,
+    IDataPacket*, packet,
+    SizeT, sampleIndex,
+    SizeT, sampleCount,
+    Bool, rawData,
+    INumber*, domainStart
+)
+
+END_NAMESPACE_OPENDAQ
@@ -392,7 +392,8 @@ void* SignalReader::getValuePacketData(const DataPacketPtr& packet) const
         case ReadMode::Unscaled:
             return packet.getRawData();
         case ReadMode::Scaled:
-            return packet.getData();
+            // The value reader applies linear scaling itself, skipping the scaled copy made by getData
+            return valueReader->readsRawData() ? packet.getRawData() : packet.getData();
     }
 
     throw InvalidOperationException("Unknown Reader read-mode of {}", static_cast<std::underlying_type_t<ReadMode>>(readMode));
@@ -0,0 +1,340 @@
+#include <opendaq/span_reader_impl.h>
+#include <opendaq/event_packet_ids.h>
+#include <opendaq/event_packet_params.h>
+#include <opendaq/input_port_factory.h>
+#include <opendaq/reader_factory.h>
+#include <coreobjects/property_object_factory.h>
+#include <coreobjects/ownable_ptr.h>
+#include <coretypes/integer_factory.h>
+#include <coretypes/validation.h>
+
+using namespace std::chrono;
+
+BEGIN_NAMESPACE_OPENDAQ
+
+SpanReaderImpl::SpanReaderImpl(const SignalPtr& signal, ReadMode mode, ReadTimeoutType timeoutType)
+    : domainReader(createReaderForType(SampleType::Int64, nullptr))
+    , readMode(mode)
+    , timeoutType(timeoutType)
+{
+    if (!signal.assigned())
+        throw ArgumentNullException("Signal must not be null.");
+
+    port = InputPort(signal.getContext(), nullptr, "readsig");
+    this->internalAddRef();
+
+    port.setListener(this->thisPtr<InputPortNotificationsPtr>());
+    port.setNotificationMethod(PacketReadyNotification::SameThread);
+    port.connect(signal);
+
+    connection = port.getConnection();
+    handleDescriptorChanged(connection.dequeue());
+}
+
+SpanReaderImpl::SpanReaderImpl(IInputPortConfig* port, ReadMode mode, ReadTimeoutType timeoutType)
+    : domainReader(createReaderForType(SampleType::Int64, nullptr))
+    , readMode(mode)
+    , timeoutType(timeoutType)
+    , portBinder(PropertyObject())
+{
+    if (!port)
+        throw ArgumentNullException("Input port must not be null.");
+
+    this->port = port;
+    this->port.asPtr<IOwnable>().setOwner(portBinder);
+
+    this->internalAddRef();
+
+    this->port.setListener(this->thisPtr<InputPortNotificationsPtr>());
+    this->port.setNotificationMethod(PacketReadyNotification::Scheduler);
+
+    if (this->port.getConnection().assigned())
+    {
+        connection = this->port.getConnection();
+        handleDescriptorChanged(connection.dequeue());
+    }
+}
+
+SpanReaderImpl::~SpanReaderImpl()
+{
+    if (port.assigned() && !portBinder.assigned())
+        port.remove();
+}
+
+ErrCode SpanReaderImpl::getAvailableCount(SizeT* count)
+{
+    OPENDAQ_PARAM_NOT_NULL(count);
+
+    std::scoped_lock lock(mutex);
+
+    return wrapHandler([count, this]
+    {
+        *count = 0;
+        if (info.dataPacket.assigned())
+        {
+            *count = info.dataPacket.getSampleCount() - info.prevSampleIndex;
+        }
+
+        if (connection.assigned())
+            *count += connection.getAvailableSamples();
+    });
+}
+
+ErrCode SpanReaderImpl::setOnDataAvailable(IProcedure* callback)
+{
+    std::scoped_lock lock(mutex, notify.mutex);
+
+    readCallback = callback;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode SpanReaderImpl::getReadMode(ReadMode* mode)
+{
+    OPENDAQ_PARAM_NOT_NULL(mode);
+
+    *mode = readMode;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode SpanReaderImpl::acceptsSignal(IInputPort* port, ISignal* signal, Bool* accept)
+{
+    OPENDAQ_PARAM_NOT_NULL(accept);
+
+    *accept = true;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode SpanReaderImpl::connected(IInputPort* port)
+{
+    OPENDAQ_PARAM_NOT_NULL(port);
+
+    std::scoped_lock lock(mutex);
+    connection = InputPortConfigPtr::Borrow(port).getConnection();
+    if (connection.assigned())
+        handleDescriptorChanged(connection.dequeue());
+
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode SpanReaderImpl::disconnected(IInputPort* port)
+{
+    OPENDAQ_PARAM_NOT_NULL(port);
+
+    std::scoped_lock lock(mutex);
+    connection = nullptr;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode SpanReaderImpl::packetReceived(IInputPort* port)
+{
+    OPENDAQ_PARAM_NOT_NULL(port);
+
+    // The read holds `mutex` while it waits for packets, so only the notification mutex may be taken here
+    ProcedurePtr callback;
+    {
+        std::scoped_lock lock(notify.mutex);
+        callback = readCallback;
+    }
+
+    notify.condition.notify_one();
+
+    if (callback.assigned())
+        return wrapHandler(callback);
+    return OPENDAQ_SUCCESS;
+}
+
+void SpanReaderImpl::handleDescriptorChanged(const EventPacketPtr& eventPacket)
+{
+    if (!eventPacket.assigned())
+        return;
+
+    auto params = eventPacket.getParameters();
+    DataDescriptorPtr newDomainDescriptor = params[event_packet_param::DOMAIN_DATA_DESCRIPTOR];
+
+    // Spans reference the value data as it is, so only the domain has to stay readable
+    if (newDomainDescriptor.assigned())
+        domainConvertible = domainReader->handleDescriptorChanged(newDomainDescriptor, ReadMode::Scaled);
+}
+
+NumberPtr SpanReaderImpl::readDomainStart()
+{
+    const auto domainPacket = info.dataPacket.getDomainPacket();
+    if (!domainPacket.assigned())
+        return nullptr;
+
+    if (!domainConvertible)
+    {
+        // The domain descriptor may not have been announced through an event packet
+        auto domainDescriptor = domainPacket.getDataDescriptor();
+        domainConvertible = domainReader->handleDescriptorChanged(domainDescriptor, ReadMode::Scaled);
+        if (!domainConvertible)
+            return nullptr;
+    }
+
+    Int start{};
+    void* startPtr = &start;
+    ErrCode errCode = domainReader->readData(domainPacket.getData(), info.prevSampleIndex, &startPtr, 1);
+    if (OPENDAQ_FAILED(errCode))
+    {
+        daqClearErrorInfo();
+        return nullptr;
+    }
+
+    return Integer(start);
+}
+
+ErrCode SpanReaderImpl::readPacketData(const ListPtr<ISampleSpan>& spans)
+{
+    const SizeT remainingSampleCount = info.dataPacket.getSampleCount() - info.prevSampleIndex;
+    const SizeT toRead = std::min(info.remainingToRead, remainingSampleCount);
+
+    ErrCode errCode = wrapHandler([this, &spans, toRead]
+    {
+        const bool rawData = readMode != ReadMode::Scaled;
+        spans.pushBack(SampleSpan(info.dataPacket, info.prevSampleIndex, toRead, rawData, readDomainStart()));
+    });
+
+    if (OPENDAQ_FAILED(errCode))
+        return errCode;
+
+    if (toRead < remainingSampleCount)
+    {
+        info.prevSampleIndex += toRead;
+    }
+    else
+    {
+        info.reset();
+    }
+
+    info.remainingToRead -= toRead;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode SpanReaderImpl::readPackets(const ListPtr<ISampleSpan>& spans, IReaderStatus** status)
+{
+    ErrCode errCode = OPENDAQ_SUCCESS;
+
+    ReadInfo::Duration remainingTime = info.timeout;
+    while (info.remainingToRead > 0 && remainingTime.count() >= 0 && connection.assigned())
+    {
+        PacketPtr packet;
+        {
+            std::unique_lock lock(notify.mutex);
+
+            packet = connection.dequeue();
+        }
+
+        if (!packet.assigned())
+        {
+            // Don't wait for any data if we already read some
+            if (timeoutType == ReadTimeoutType::Any && spans.getCount() > 0)
+            {
+                break;
+            }
+
+            std::unique_lock notifyLock(notify.mutex);
+            if (notify.condition.wait_for(notifyLock, remainingTime, [this]
+            {
+                return connection.peek().assigned();
+            }))
+            {
+                packet = connection.dequeue();
+            }
+            else
+            {
+                break;
+            }
+        }
+
+        switch (packet.getType())
+        {
+            case PacketType::Data:
+            {
+                info.dataPacket = packet;
+
+                errCode = readPacketData(spans);
+                if (OPENDAQ_FAILED(errCode))
+                    return errCode;
+                break;
+            }
+            case PacketType::Event:
+            {
+                auto eventPacket = packet.asPtrOrNull<IEventPacket>(true);
+                if (eventPacket.getEventId() == event_packet_id::DATA_DESCRIPTOR_CHANGED)
+                {
+                    errCode = wrapHandler(this, &SpanReaderImpl::handleDescriptorChanged, eventPacket);
+                    if (OPENDAQ_FAILED(errCode))
+                    {
+                        return this->makeErrorInfo(
+                            OPENDAQ_ERR_INVALID_DATA,
+                            "Exception occurred while processing a signal descriptor change"
+                        );
+                    }
+
+                    if (status)
+                        *status = ReaderStatus(eventPacket, true).detach();
+                    return errCode;
+                }
+                break;
+            }
+            case PacketType::None:
+                break;
+        }
+
+        if (info.timeout.count() != 0)
+            remainingTime = info.timeout - info.durationFromStart();
+    }
+
+    return errCode;
+}
+
+ErrCode SpanReaderImpl::read(IList** spans, SizeT* count, SizeT timeoutMs, IReaderStatus** status)
+{
+    OPENDAQ_PARAM_NOT_NULL(spans);
+    OPENDAQ_PARAM_NOT_NULL(count);
+
+    std::scoped_lock lock(mutex);
+
+    if (status)
+        *status = nullptr;
+
+    auto readSpans = List<ISampleSpan>();
+
+    // Spans reference the packets, so no output buffer is needed
+    info.prepare(nullptr, *count, milliseconds(timeoutMs));
+
+    ErrCode errCode = OPENDAQ_SUCCESS;
+    if (info.dataPacket.assigned() && info.remainingToRead > 0)
+    {
+        errCode = readPacketData(readSpans);
+    }
+
+    const bool shouldReturnEarly = timeoutType == ReadTimeoutType::Any && info.remainingToRead != *count;
+
+    if (OPENDAQ_SUCCEEDED(errCode) && !shouldReturnEarly)
+        errCode = readPackets(readSpans, status);
+
+    if (status && *status == nullptr)
+        *status = ReaderStatus().detach();
+
+    *count = *count - info.remainingToRead;
+    *spans = readSpans.detach();
+    return errCode;
+}
+
+OPENDAQ_DEFINE_CLASS_FACTORY(
+    LIBRARY_FACTORY, SpanReader,
+    ISignal*, signal,
+    ReadMode, mode,
+    ReadTimeoutType, timeoutType
+)
+
+OPENDAQ_DEFINE_CLASS_FACTORY_WITH_INTERFACE_AND_CREATEFUNC(
+    LIBRARY_FACTORY, SpanReader,
+    ISpanReader, createSpanReaderFromPort,
+    IInputPortConfig*, port,
+    ReadMode, mode,
+    ReadTimeoutType, timeoutType
+)
+
+END_NAMESPACE_OPENDAQ
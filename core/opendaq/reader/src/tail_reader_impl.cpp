@@ -1,6 +1,9 @@
+#include <opendaq/connection_utils.h>
 #include <opendaq/reader_errors.h>
 #include <opendaq/tail_reader_impl.h>
 #include <opendaq/reader_factory.h>
+#include <opendaq/sample_type_traits.h>
+#include <cstring>
 
 BEGIN_NAMESPACE_OPENDAQ
 
@@ -8,13 +11,18 @@ TailReaderImpl::TailReaderImpl(ISignal* signal,
                                SizeT historySize,
                                SampleType valueReadType,
                                SampleType domainReadType,
-                               ReadMode mode)
+                               ReadMode mode,
+                               Bool ringBuffer)
     : Super(SignalPtr(signal), mode, valueReadType, domainReadType)
     , historySize(historySize)
     , cachedSamples(0)
+    , ringBuffer(ringBuffer)
 {
     port.setNotificationMethod(PacketReadyNotification::SameThread);
     TailReaderImpl::handleDescriptorChanged(connection.dequeue());
+
+    if (this->ringBuffer)
+        resetRingBuffer();
 }
 
 TailReaderImpl::TailReaderImpl(IInputPortConfig* port,
@@ -52,10 +60,14 @@ TailReaderImpl::TailReaderImpl(TailReaderImpl* old,
     , historySize(historySize)
     , cachedSamples(old->cachedSamples)
     , packets(old->packets)
-    
+    , ringBuffer(old->ringBuffer)
 {
     handleDescriptorChanged(DataDescriptorChangedEventPacket(dataDescriptor, nullptr));
     readDescriptorFromPort();
+
+    // The buffered samples are already converted to the old read types so they can't be carried over
+    if (ringBuffer)
+        resetRingBuffer();
 }
 
 ErrCode TailReaderImpl::getAvailableCount(SizeT* count)
@@ -148,6 +160,9 @@ ErrCode TailReaderImpl::readData(TailReaderInfo& info, IReaderStatus** status)
         return makeErrorInfo(OPENDAQ_ERR_SIZETOOLARGE, "The requested sample-count exceeds the reader history size.");
     }
 
+    if (ringBuffer)
+        return readRingBuffer(info, status);
+
     if (cachedSamples > info.remainingToRead)
         info.offset = cachedSamples - info.remainingToRead;
 
@@ -215,9 +230,14 @@ ErrCode TailReaderImpl::readWithDomain(void* values, void* domain, SizeT* count,
 ErrCode TailReaderImpl::packetReceived(IInputPort* /*port*/)
 {
     std::unique_lock lock(mutex);
-    PacketPtr packet = connection.dequeue();
-    while (packet.assigned())
+    processQueuedPackets(connection, [this](const PacketPtr& packet)
     {
+        if (ringBuffer)
+        {
+            handleRingBufferPacket(packet);
+            return;
+        }
+
         switch (packet.getType())
         {
             case PacketType::Data:
@@ -239,7 +259,7 @@ ErrCode TailReaderImpl::packetReceived(IInputPort* /*port*/)
                             ++it;
                             continue;
                         }
-                
+
                         auto tmpPacket = it->asPtrOrNull<IDataPacket>(true);
                         SizeT sampleCount = tmpPacket.getSampleCount();
                         if (availableSamples - sampleCount >= historySize)
@@ -268,9 +288,7 @@ ErrCode TailReaderImpl::packetReceived(IInputPort* /*port*/)
             case PacketType::None:
                 break;
         }
-
-        packet = connection.dequeue();
-    }
+    });
 
     auto callback = readCallback;
     if (callback.assigned() && cachedSamples >= historySize)
@@ -281,6 +299,189 @@ ErrCode TailReaderImpl::packetReceived(IInputPort* /*port*/)
     return OPENDAQ_SUCCESS;
 }
 
+void TailReaderImpl::resetRingBuffer()
+{
+    SizeT valuesPerSample = 1;
+    if (dataDescriptor.assigned())
+    {
+        auto dimensions = dataDescriptor.getDimensions();
+        if (dimensions.assigned() && dimensions.getCount() == 1)
+            valuesPerSample = dimensions[0].getSize();
+    }
+
+    valueSampleSize = valueReader->isUndefined() ? 0 : getSampleSize(valueReader->getReadType()) * valuesPerSample;
+    valueBuffer.assign(historySize * valueSampleSize, 0);
+
+    // The domain buffer is allocated with the first domain packet when the domain read-type is not known yet
+    domainSampleSize = domainReader->isUndefined() ? 0 : getSampleSize(domainReader->getReadType());
+    domainBuffer.assign(historySize * domainSampleSize, 0);
+
+    cachedSamples = 0;
+    ringStart = 0;
+    domainSamples = 0;
+}
+
+void TailReaderImpl::allocateDomainBuffer()
+{
+    const SizeT sampleSize = getSampleSize(domainReader->getReadType());
+    if (!domainBuffer.empty() && sampleSize == domainSampleSize)
+        return;
+
+    domainSampleSize = sampleSize;
+    domainBuffer.assign(historySize * domainSampleSize, 0);
+    domainSamples = 0;
+}
+
+void TailReaderImpl::handleRingBufferPacket(const PacketPtr& packet)
+{
+    switch (packet.getType())
+    {
+        case PacketType::Data:
+        {
+            ErrCode errCode = writeRingBuffer(packet.asPtr<IDataPacket>(true));
+            if (OPENDAQ_FAILED(errCode))
+            {
+                // Samples that can't be converted would leave a gap in the history
+                daqClearErrorInfo();
+                invalid = true;
+            }
+            break;
+        }
+        case PacketType::Event:
+        {
+            auto eventPacket = packet.asPtr<IEventPacket>(true);
+            if (eventPacket.getEventId() == event_packet_id::DATA_DESCRIPTOR_CHANGED)
+            {
+                handleDescriptorChanged(eventPacket);
+                resetRingBuffer();
+            }
+
+            pendingEvent = eventPacket;
+            break;
+        }
+        case PacketType::None:
+            break;
+    }
+}
+
+ErrCode TailReaderImpl::writeRingBuffer(
+    Reader& reader, std::vector<uint8_t>& buffer, SizeT sampleSize, void* data, SizeT offset, SizeT position, SizeT count)
+{
+    // At most two conversions with the second one continuing at the start of the buffer
+    const SizeT firstCount = std::min(count, historySize - position);
+
+    void* out = buffer.data() + position * sampleSize;
+    ErrCode errCode = reader.readData(data, offset, &out, firstCount);
+    if (OPENDAQ_FAILED(errCode) || firstCount == count)
+        return errCode;
+
+    out = buffer.data();
+    return reader.readData(data, offset + firstCount, &out, count - firstCount);
+}
+
+ErrCode TailReaderImpl::writeRingBuffer(const DataPacketPtr& dataPacket)
+{
+    const SizeT sampleCount = dataPacket.getSampleCount();
+    if (sampleCount == 0 || historySize == 0 || invalid)
+        return OPENDAQ_SUCCESS;
+
+    if (valueSampleSize == 0)
+        return makeErrorInfo(OPENDAQ_ERR_INVALIDSTATE, "The reader value read-type does not have a fixed sample size.");
+
+    // Only the last historySize samples of the packet can remain in the buffer
+    const SizeT offset = sampleCount > historySize ? sampleCount - historySize : 0;
+    const SizeT count = sampleCount - offset;
+    const SizeT position = (ringStart + cachedSamples) % historySize;
+
+    ErrCode errCode = writeRingBuffer(*valueReader, valueBuffer, valueSampleSize, getValuePacketData(dataPacket), offset, position, count);
+    if (OPENDAQ_FAILED(errCode))
+        return errCode;
+
+    bool hasDomain = false;
+    auto domainPacket = dataPacket.getDomainPacket();
+    if (domainPacket.assigned() && (!domainReader->isUndefined() || trySetDomainSampleType(domainPacket)))
+    {
+        allocateDomainBuffer();
+
+        if (domainSampleSize != 0)
+        {
+            errCode = writeRingBuffer(*domainReader, domainBuffer, domainSampleSize, domainPacket.getData(), offset, position, count);
+            if (errCode == OPENDAQ_ERR_INVALIDSTATE && trySetDomainSampleType(domainPacket))
+            {
+                // The domain samples already in the buffer are of the previous read-type
+                daqClearErrorInfo();
+                domainSamples = 0;
+                allocateDomainBuffer();
+                errCode = writeRingBuffer(*domainReader, domainBuffer, domainSampleSize, domainPacket.getData(), offset, position, count);
+            }
+
+            hasDomain = OPENDAQ_SUCCEEDED(errCode);
+            if (!hasDomain)
+                daqClearErrorInfo();
+        }
+    }
+
+    domainSamples = hasDomain ? std::min(domainSamples + count, historySize) : 0;
+
+    if (cachedSamples + count > historySize)
+    {
+        ringStart = (ringStart + cachedSamples + count - historySize) % historySize;
+        cachedSamples = historySize;
+    }
+    else
+    {
+        cachedSamples += count;
+    }
+
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode TailReaderImpl::readRingBuffer(TailReaderInfo& info, IReaderStatus** status)
+{
+    if (pendingEvent.assigned())
+    {
+        if (status)
+            *status = ReaderStatus(pendingEvent, !invalid).detach();
+
+        pendingEvent = nullptr;
+        return OPENDAQ_SUCCESS;
+    }
+
+    if (invalid)
+    {
+        if (status)
+            *status = ReaderStatus(nullptr, false).detach();
+        return OPENDAQ_SUCCESS;
+    }
+
+    const SizeT count = std::min(info.remainingToRead, cachedSamples);
+    if (info.domainValues != nullptr && count > domainSamples)
+    {
+        return makeErrorInfo(OPENDAQ_ERR_INVALIDSTATE, "Packets must have an associated domain packets to read domain data.");
+    }
+
+    const SizeT start = (ringStart + cachedSamples - count) % historySize;
+    const SizeT firstCount = std::min(count, historySize - start);
+
+    const auto copy = [&](const std::vector<uint8_t>& buffer, SizeT sampleSize, void* out)
+    {
+        auto* outBytes = static_cast<uint8_t*>(out);
+        std::memcpy(outBytes, buffer.data() + start * sampleSize, firstCount * sampleSize);
+        std::memcpy(outBytes + firstCount * sampleSize, buffer.data(), (count - firstCount) * sampleSize);
+    };
+
+    copy(valueBuffer, valueSampleSize, info.values);
+    if (info.domainValues != nullptr)
+        copy(domainBuffer, domainSampleSize, info.domainValues);
+
+    info.remainingToRead -= count;
+
+    if (status)
+        *status = ReaderStatus().detach();
+
+    return OPENDAQ_SUCCESS;
+}
+
 OPENDAQ_DEFINE_CLASS_FACTORY(
     LIBRARY_FACTORY, TailReader,
     ISignal*, signal,
@@ -327,6 +528,17 @@ OPENDAQ_DEFINE_CUSTOM_CLASS_FACTORY_WITH_INTERFACE_AND_CREATEFUNC_OBJ(
     SampleType, domainReadType
 )
 
+OPENDAQ_DEFINE_CLASS_FACTORY_WITH_INTERFACE_AND_CREATEFUNC(
+    LIBRARY_FACTORY, TailReader,
+    ITailReader, createTailReaderEx,
+    ISignal*, signal,
+    SizeT, historySize,
+    SampleType, valueReadType,
+    SampleType, domainReadType,
+    ReadMode, mode,
+    Bool, ringBuffer
+)
+
 OPENDAQ_DEFINE_CLASS_FACTORY_WITH_INTERFACE_AND_CREATEFUNC(
     LIBRARY_FACTORY, TailReader,
     ITailReader, createTailReaderFromPort,
@@ -4,7 +4,9 @@
 #include <opendaq/reader_errors.h>
 #include <opendaq/signal_errors.h>
 #include <opendaq/multi_typed_reader.h>
+#include <opendaq/scaling_kernels.h>
 
+#include <algorithm>
 #include <utility>
 
 BEGIN_NAMESPACE_OPENDAQ
@@ -162,7 +164,10 @@ std::unique_ptr<Comparable> TypedReader<ReadType>::readStart(void* inputBuffer,
 template <typename ReadType>
 ErrCode TypedReader<ReadType>::readData(void* inputBuffer, SizeT offset, void** outputBuffer, SizeT count)
 {
-    switch (dataSampleType)
+    // The transform function operates on scaled data, so the caller passes the scaled packet data in that case
+    const SampleType inputSampleType = scaleRawData && !readsRawData() ? scaledSampleType : dataSampleType;
+
+    switch (inputSampleType)
     {
         case SampleType::Float32:
             return readValues<SampleTypeToType<SampleType::Float32>::Type>(inputBuffer, offset, outputBuffer, count);
@@ -349,21 +354,47 @@ ErrCode TypedReader<TReadType>::readValues(void* inputBuffer, SizeT offset, void
             return OPENDAQ_SUCCESS;
         }
 
+        const SizeT valueCount = toRead * valuesPerSample;
+
+        if constexpr (std::is_arithmetic_v<TDataType> && std::is_arithmetic_v<TReadType>)
+        {
+            if (readsRawData())
+            {
+                if (scaledSampleType == SampleType::Float32)
+                    scaleValues<TDataType, float>(dataStart, dataOut, valueCount);
+                else
+                    scaleValues<TDataType, double>(dataStart, dataOut, valueCount);
+
+                *outputBuffer = dataOut + valueCount;
+                return OPENDAQ_SUCCESS;
+            }
+        }
+
         // If the type of samples is the same, then just copy
         if (std::is_same_v<TReadType, TDataType>)
         {
             // Returns the pointer to the value after the last copied one
-            *outputBuffer = std::copy_n(dataStart, valuesPerSample * toRead, dataOut);
+            *outputBuffer = std::copy_n(dataStart, valueCount, dataOut);
         }
         else
         {
-            for (std::size_t i = 0; i < toRead * valuesPerSample; ++i)
+            if constexpr (std::is_arithmetic_v<TDataType> && std::is_arithmetic_v<TReadType>)
+            {
+                if (convertKernel)
+                {
+                    reinterpret_cast<ConvertKernel<TDataType, TReadType>>(convertKernel)(dataStart, dataOut, valueCount);
+                    *outputBuffer = dataOut + valueCount;
+                    return OPENDAQ_SUCCESS;
+                }
+            }
+
+            for (std::size_t i = 0; i < valueCount; ++i)
             {
                 dataOut[i] = (TReadType) dataStart[i];
             }
 
             // Set the pointer to the value after the last copied one
-            *outputBuffer = &dataOut[toRead];
+            *outputBuffer = dataOut + valueCount;
         }
 
         return OPENDAQ_SUCCESS;
@@ -378,6 +409,35 @@ ErrCode TypedReader<TReadType>::readValues(void* inputBuffer, SizeT offset, void
     }
 }
 
+template <typename TReadType>
+template <typename TDataType, typename TScaledType>
+void TypedReader<TReadType>::scaleValues(const TDataType* dataStart, TReadType* dataOut, SizeT valueCount) const
+{
+    const auto scale = static_cast<TScaledType>(scalingScale);
+    const auto offset = static_cast<TScaledType>(scalingOffset);
+    const auto kernel = reinterpret_cast<LinearScaleKernel<TDataType, TScaledType>>(scaleKernel);
+
+    if constexpr (std::is_same_v<TReadType, TScaledType>)
+    {
+        kernel(dataStart, dataOut, valueCount, scale, offset);
+    }
+    else
+    {
+        // Scale in the scaling output type first, so the values match converting the scaled packet data
+        constexpr SizeT chunkSize = 256;
+        TScaledType chunk[chunkSize];
+
+        for (SizeT i = 0; i < valueCount; i += chunkSize)
+        {
+            const SizeT count = std::min(chunkSize, valueCount - i);
+            kernel(dataStart + i, chunk, count, scale, offset);
+
+            for (SizeT k = 0; k < count; ++k)
+                dataOut[i + k] = static_cast<TReadType>(chunk[k]);
+        }
+    }
+}
+
 template <>
 template <>
 ErrCode TypedReader<ClockTick>::readValues<ClockRange>(void* inputBuffer, SizeT offset, void** outputBuffer, SizeT toRead) const
@@ -403,6 +463,72 @@ ErrCode TypedReader<ClockTick>::readValues<ClockRange>(void* inputBuffer, SizeT
     return OPENDAQ_SUCCESS;
 }
 
+// The scalar loop is compiled with the vector kernels so scaled values do not depend on the instruction set
+template <typename T, typename U>
+static LinearScaleKernel<T, U> selectScaleKernel()
+{
+    const auto kernel = getLinearScaleKernel<T, U>();
+    return kernel ? kernel : getScalarLinearScaleKernel<T, U>();
+}
+
+template <typename TReadType>
+template <typename TDataType>
+void TypedReader<TReadType>::selectKernelsFor()
+{
+    if constexpr (std::is_arithmetic_v<TDataType> && std::is_arithmetic_v<TReadType>)
+    {
+        if (!scaleRawData)
+            convertKernel = reinterpret_cast<ErasedKernel>(getConvertKernel<TDataType, TReadType>());
+        else if (scaledSampleType == SampleType::Float32)
+            scaleKernel = reinterpret_cast<ErasedKernel>(selectScaleKernel<TDataType, float>());
+        else
+            scaleKernel = reinterpret_cast<ErasedKernel>(selectScaleKernel<TDataType, double>());
+    }
+}
+
+template <typename ReadType>
+void TypedReader<ReadType>::selectKernels()
+{
+    convertKernel = nullptr;
+    scaleKernel = nullptr;
+
+    switch (dataSampleType)
+    {
+        case SampleType::Float32:
+            selectKernelsFor<SampleTypeToType<SampleType::Float32>::Type>();
+            break;
+        case SampleType::Float64:
+            selectKernelsFor<SampleTypeToType<SampleType::Float64>::Type>();
+            break;
+        case SampleType::UInt8:
+            selectKernelsFor<SampleTypeToType<SampleType::UInt8>::Type>();
+            break;
+        case SampleType::Int8:
+            selectKernelsFor<SampleTypeToType<SampleType::Int8>::Type>();
+            break;
+        case SampleType::UInt16:
+            selectKernelsFor<SampleTypeToType<SampleType::UInt16>::Type>();
+            break;
+        case SampleType::Int16:
+            selectKernelsFor<SampleTypeToType<SampleType::Int16>::Type>();
+            break;
+        case SampleType::UInt32:
+            selectKernelsFor<SampleTypeToType<SampleType::UInt32>::Type>();
+            break;
+        case SampleType::Int32:
+            selectKernelsFor<SampleTypeToType<SampleType::Int32>::Type>();
+            break;
+        case SampleType::UInt64:
+            selectKernelsFor<SampleTypeToType<SampleType::UInt64>::Type>();
+            break;
+        case SampleType::Int64:
+            selectKernelsFor<SampleTypeToType<SampleType::Int64>::Type>();
+            break;
+        default:
+            break;
+    }
+}
+
 template <typename ReadType>
 bool TypedReader<ReadType>::handleDescriptorChanged(DataDescriptorPtr& descriptor, ReadMode readMode)
 {
@@ -434,6 +560,23 @@ bool TypedReader<ReadType>::handleDescriptorChanged(DataDescriptorPtr& descripto
             valid = isSampleTypeConvertibleTo<ReadType>(dataSampleType);
         }
 
+        // Linear scaling is applied while reading the raw data instead of reading the scaled copy made by getData
+        scaleRawData = false;
+        if constexpr (std::is_arithmetic_v<ReadType>)
+        {
+            if (valid && postScaling.assigned() && readMode == ReadMode::Scaled && postScaling.getType() == ScalingType::Linear)
+            {
+                const auto parameters = postScaling.getParameters();
+                const Float scale = parameters.get("scale");
+                const Float offset = parameters.get("offset");
+                scalingScale = scale;
+                scalingOffset = offset;
+                scaledSampleType = dataSampleType;
+                dataSampleType = postScaling.getInputSampleType();
+                scaleRawData = true;
+            }
+        }
+
         rawSampleSize = descriptor.getRawSampleSize();
         auto dimensions = descriptor.getDimensions();
         if (dimensions.assigned() && dimensions.getCount() == 1)
@@ -442,6 +585,7 @@ bool TypedReader<ReadType>::handleDescriptorChanged(DataDescriptorPtr& descripto
         }
 
         dataDescriptor = descriptor;
+        selectKernels();
     }
 
     return valid;
@@ -483,6 +627,11 @@ void Reader::setTransformIgnore(bool ignore)
     ignoreTransform = ignore;
 }
 
+bool Reader::readsRawData() const noexcept
+{
+    return scaleRawData && (ignoreTransform || !transformFunction.assigned());
+}
+
 std::unique_ptr<Reader> createReaderForType(SampleType readType, const FunctionPtr& transformFunction)
 {
     switch (readType)
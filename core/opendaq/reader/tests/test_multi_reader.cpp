@@ -692,6 +692,58 @@ TEST_F(MultiReaderTest, SignalStartDomainFrom0TimeoutExceeded)
     ASSERT_THAT(time[2], ElementsAreArray(time[0]));
 }
 
+TEST_F(MultiReaderTest, SignalStartDomainFrom0TimeoutAny)
+{
+    using namespace std::chrono;
+    using namespace std::chrono_literals;
+
+    constexpr const auto NUM_SIGNALS = 3;
+    constexpr const auto SIG1_PACKET_SIZE = 523;
+
+    // prevent vector from re-allocating so we have "stable" pointers
+    readSignals.reserve(3);
+
+    auto& sig0 = addSignal(0, SIG1_PACKET_SIZE, createDomainSignal("2022-09-27T00:02:03+00:00"));
+    auto& sig1 = addSignal(0, 732, createDomainSignal("2022-09-27T00:02:04+00:00"));
+    auto& sig2 = addSignal(0, 843, createDomainSignal("2022-09-27T00:02:04.123+00:00"));
+
+    auto multi = MultiReader(signalsToList(), ReadTimeoutType::Any);
+
+    sig0.createAndSendPacket(0);
+    sig1.createAndSendPacket(0);
+    sig2.createAndSendPacket(0);
+
+    sig0.createAndSendPacket(1);
+    sig1.createAndSendPacket(1);
+    sig2.createAndSendPacket(1);
+
+    sig0.createAndSendPacket(2);
+    sig1.createAndSendPacket(2);
+    sig2.createAndSendPacket(2);
+
+    auto available = multi.getAvailableCount();
+    ASSERT_EQ(available, 446u);
+
+    constexpr const SizeT SAMPLES = SIG1_PACKET_SIZE * 2;
+
+    std::array<double[SAMPLES], NUM_SIGNALS> values{};
+    std::array<ClockTick[SAMPLES], NUM_SIGNALS> domain{};
+
+    void* valuesPerSignal[NUM_SIGNALS]{values[0], values[1], values[2]};
+    void* domainPerSignal[NUM_SIGNALS]{domain[0], domain[1], domain[2]};
+
+    auto start = std::chrono::system_clock::now();
+
+    SizeT count{SAMPLES};
+    multi.readWithDomain(valuesPerSignal, domainPerSignal, &count, 1000);
+
+    auto end = std::chrono::system_clock::now();
+
+    // Returns with the available samples instead of waiting for the whole timeout
+    ASSERT_LT(end - start, 500ms);
+    ASSERT_EQ(count, available);
+}
+
 TEST_F(MultiReaderTest, WithPacketOffsetNot0)
 {
     constexpr const auto NUM_SIGNALS = 3;
@@ -1814,3 +1866,55 @@ TEST_F(MultiReaderTest, StartOnFullUnitOfDomain)
     ASSERT_THAT(time[1], ElementsAreArray(time[0]));
     ASSERT_THAT(time[2], ElementsAreArray(time[0]));
 }
+
+TEST_F(MultiReaderTest, ParallelRead)
+{
+    constexpr const auto NUM_SIGNALS = 3;
+
+    // prevent vector from re-allocating, so we have "stable" pointers
+    readSignals.reserve(3);
+
+    auto& sig0 = addSignal(0, 523, createDomainSignal("2022-09-27T00:02:03+00:00"));
+    auto& sig1 = addSignal(0, 732, createDomainSignal("2022-09-27T00:02:04+00:00"));
+    auto& sig2 = addSignal(0, 843, createDomainSignal("2022-09-27T00:02:04.123+00:00"));
+
+    // Every read is split among the scheduler workers
+    auto multi = MultiReaderEx(signalsToList(), ReadTimeoutType::All, false, 1);
+    auto reference = MultiReader(signalsToList());
+
+    for (Int i = 0; i < 3; i++)
+    {
+        sig0.createAndSendPacket(i);
+        sig1.createAndSendPacket(i);
+        sig2.createAndSendPacket(i);
+    }
+
+    ASSERT_EQ(multi.getAvailableCount(), 446u);
+    ASSERT_EQ(reference.getAvailableCount(), 446u);
+
+    constexpr const SizeT SAMPLES = 446u;
+
+    std::array<double[SAMPLES], NUM_SIGNALS> values{};
+    std::array<ClockTick[SAMPLES], NUM_SIGNALS> domain{};
+    std::array<double[SAMPLES], NUM_SIGNALS> referenceValues{};
+    std::array<ClockTick[SAMPLES], NUM_SIGNALS> referenceDomain{};
+
+    void* valuesPerSignal[NUM_SIGNALS]{values[0], values[1], values[2]};
+    void* domainPerSignal[NUM_SIGNALS]{domain[0], domain[1], domain[2]};
+    void* referenceValuesPerSignal[NUM_SIGNALS]{referenceValues[0], referenceValues[1], referenceValues[2]};
+    void* referenceDomainPerSignal[NUM_SIGNALS]{referenceDomain[0], referenceDomain[1], referenceDomain[2]};
+
+    SizeT count{SAMPLES};
+    multi.readWithDomain(valuesPerSignal, domainPerSignal, &count);
+    ASSERT_EQ(count, SAMPLES);
+
+    SizeT referenceCount{SAMPLES};
+    reference.readWithDomain(referenceValuesPerSignal, referenceDomainPerSignal, &referenceCount);
+    ASSERT_EQ(referenceCount, SAMPLES);
+
+    for (SizeT i = 0; i < NUM_SIGNALS; ++i)
+    {
+        ASSERT_THAT(values[i], ElementsAreArray(referenceValues[i]));
+        ASSERT_THAT(domain[i], ElementsAreArray(referenceDomain[i]));
+    }
+}
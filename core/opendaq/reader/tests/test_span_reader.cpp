@@ -0,0 +1,181 @@
+#include <testutils/testutils.h>
+#include "reader_common.h"
+#include <opendaq/span_reader_ptr.h>
+#include <opendaq/sample_span_ptr.h>
+#include <opendaq/data_packet_ptr.h>
+#include <opendaq/reader_factory.h>
+#include <opendaq/reader_status_ptr.h>
+#include <opendaq/scaling_factory.h>
+
+using namespace daq;
+
+using SpanReaderTest = ReaderTest<>;
+
+TEST_F(SpanReaderTest, Create)
+{
+    ASSERT_NO_THROW(SpanReader(this->signal));
+}
+
+TEST_F(SpanReaderTest, CreateNullThrows)
+{
+    ASSERT_THROW_MSG(SpanReader(nullptr), ArgumentNullException, "Signal must not be null.")
+}
+
+TEST_F(SpanReaderTest, ReadReferencesPacketData)
+{
+    this->signal.setDescriptor(setupDescriptor(SampleType::Float64));
+
+    auto reader = SpanReader(this->signal);
+
+    const SizeT NUM_SAMPLES = 10;
+    auto dataPacket = this->createDataPacket(NUM_SAMPLES, 5);
+    auto dataPtr = static_cast<double*>(dataPacket.getData());
+    for (SizeT i = 0; i < NUM_SAMPLES; ++i)
+        dataPtr[i] = static_cast<double>(i) * 1.5;
+
+    this->sendPacket(dataPacket);
+    ASSERT_EQ(reader.getAvailableCount(), NUM_SAMPLES);
+
+    ListPtr<ISampleSpan> spans;
+    ReaderStatusPtr status;
+    SizeT count{4};
+    ASSERT_SUCCEEDED(reader->read(&spans, &count, 0, &status));
+
+    ASSERT_EQ(count, 4u);
+    ASSERT_EQ(status.getReadStatus(), ReadStatus::Ok);
+    ASSERT_EQ(spans.getCount(), 1u);
+
+    SampleSpanPtr span = spans[0];
+    ASSERT_EQ(span.getData(), static_cast<void*>(dataPtr));
+    ASSERT_EQ(span.getSampleCount(), 4u);
+    ASSERT_EQ(span.getDomainStart().getIntValue(), 5);
+    ASSERT_EQ(span.getPacket(), dataPacket);
+
+    // The rest of the packet continues where the previous read stopped
+    count = NUM_SAMPLES;
+    ASSERT_SUCCEEDED(reader->read(&spans, &count, 0, &status));
+
+    ASSERT_EQ(count, 6u);
+    ASSERT_EQ(spans.getCount(), 1u);
+
+    span = spans[0];
+    ASSERT_EQ(span.getData(), static_cast<void*>(dataPtr + 4));
+    ASSERT_EQ(span.getSampleCount(), 6u);
+    ASSERT_EQ(span.getDomainStart().getIntValue(), 9);
+    ASSERT_EQ(static_cast<double*>(span.getData())[5], 13.5);
+
+    ASSERT_EQ(reader.getAvailableCount(), 0u);
+}
+
+TEST_F(SpanReaderTest, ReadAcrossPackets)
+{
+    this->signal.setDescriptor(setupDescriptor(SampleType::Int32));
+
+    auto reader = SpanReader(this->signal);
+
+    auto firstPacket = this->createDataPacket(3, 0);
+    auto secondPacket = this->createDataPacket(5, 3);
+    this->sendPacket(firstPacket);
+    this->sendPacket(secondPacket);
+
+    ListPtr<ISampleSpan> spans;
+    SizeT count{6};
+    ASSERT_SUCCEEDED(reader->read(&spans, &count, 0, nullptr));
+
+    ASSERT_EQ(count, 6u);
+    ASSERT_EQ(spans.getCount(), 2u);
+
+    SampleSpanPtr first = spans[0];
+    ASSERT_EQ(first.getData(), firstPacket.getData());
+    ASSERT_EQ(first.getSampleCount(), 3u);
+    ASSERT_EQ(first.getDomainStart().getIntValue(), 0);
+
+    SampleSpanPtr second = spans[1];
+    ASSERT_EQ(second.getData(), secondPacket.getData());
+    ASSERT_EQ(second.getSampleCount(), 3u);
+    ASSERT_EQ(second.getDomainStart().getIntValue(), 3);
+
+    ASSERT_EQ(reader.getAvailableCount(), 2u);
+}
+
+TEST_F(SpanReaderTest, ReadUnscaledData)
+{
+    const auto scaling = LinearScaling(0.5, 3.0, SampleType::Int16, ScaledSampleType::Float64);
+    this->signal.setDescriptor(setupDescriptor(SampleType::Float64, nullptr, scaling));
+
+    auto reader = SpanReader(this->signal, ReadMode::Unscaled);
+
+    auto dataPacket = DataPacket(this->signal.getDescriptor(), 4);
+    this->sendPacket(dataPacket);
+
+    ListPtr<ISampleSpan> spans;
+    SizeT count{4};
+    ASSERT_SUCCEEDED(reader->read(&spans, &count, 0, nullptr));
+
+    ASSERT_EQ(count, 4u);
+    ASSERT_EQ(spans.getCount(), 1u);
+
+    SampleSpanPtr span = spans[0];
+    ASSERT_EQ(span.getData(), dataPacket.getRawData());
+    ASSERT_FALSE(span.getDomainStart().assigned());
+}
+
+TEST_F(SpanReaderTest, DescriptorChanged)
+{
+    this->signal.setDescriptor(setupDescriptor(SampleType::Float64));
+
+    auto reader = SpanReader(this->signal);
+
+    auto doublePacket = this->createDataPacket(2, 0);
+    this->sendPacket(doublePacket);
+
+    this->signal.setDescriptor(setupDescriptor(SampleType::Int32));
+    auto intPacket = this->createDataPacket(2, 2);
+    this->sendPacket(intPacket);
+
+    ListPtr<ISampleSpan> spans;
+    ReaderStatusPtr status;
+    SizeT count{4};
+    ASSERT_SUCCEEDED(reader->read(&spans, &count, 0, &status));
+
+    // The read stops at the descriptor change and returns the spans read before it
+    ASSERT_EQ(count, 2u);
+    ASSERT_EQ(spans.getCount(), 1u);
+    ASSERT_EQ(status.getReadStatus(), ReadStatus::Event);
+    ASSERT_TRUE(status.getValid());
+
+    count = 4;
+    ASSERT_SUCCEEDED(reader->read(&spans, &count, 0, &status));
+
+    ASSERT_EQ(count, 2u);
+    ASSERT_EQ(status.getReadStatus(), ReadStatus::Ok);
+
+    SampleSpanPtr span = spans[0];
+    ASSERT_EQ(span.getPacket().getDataDescriptor().getSampleType(), SampleType::Int32);
+    ASSERT_EQ(span.getData(), intPacket.getData());
+}
+
+TEST_F(SpanReaderTest, WaitingReadDoesNotBlockSender)
+{
+    this->signal.setDescriptor(setupDescriptor(SampleType::Float64));
+
+    auto reader = SpanReader(this->signal);
+
+    ListPtr<ISampleSpan> spans;
+    ReaderStatusPtr status;
+    SizeT count{4};
+    std::thread readThread([&] { reader->read(&spans, &count, 5000, &status); });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    // The packet is delivered on this thread while the read is waiting for it
+    const auto start = std::chrono::steady_clock::now();
+    this->sendPacket(this->createDataPacket(4, 0), false);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    readThread.join();
+
+    ASSERT_LT(elapsed, std::chrono::seconds(1));
+    ASSERT_EQ(count, 4u);
+    ASSERT_EQ(spans.getCount(), 1u);
+}
@@ -10,6 +10,7 @@
 #include <opendaq/reader_factory.h>
 #include <opendaq/input_port_factory.h>
 #include <opendaq/dimension_factory.h>
+#include <opendaq/scaling_factory.h>
 #include <future>
 
 using namespace daq;
@@ -522,6 +523,74 @@ TYPED_TEST(StreamReaderTest, ReadValuesMoreThanAvailable)
     ASSERT_EQ(reader.getAvailableCount(), 0u);
 }
 
+using StreamReaderConversionTest = ReaderTest<>;
+
+TEST_F(StreamReaderConversionTest, ReadInt16AsFloat64)
+{
+    this->signal.setDescriptor(setupDescriptor(SampleType::Int16));
+
+    auto reader = daq::StreamReader<double, ClockRange>(this->signal);
+
+    // Not a multiple of the vector width, so the conversion also runs its scalar tail
+    const SizeT NUM_SAMPLES = 37;
+    auto dataPacket = DataPacket(this->signal.getDescriptor(), NUM_SAMPLES);
+    auto dataPtr = static_cast<int16_t*>(dataPacket.getData());
+    for (SizeT i = 0; i < NUM_SAMPLES; ++i)
+        dataPtr[i] = static_cast<int16_t>(static_cast<int>(i) * 1000 - 15000);
+
+    this->sendPacket(dataPacket);
+
+    SizeT count{NUM_SAMPLES};
+    double samples[NUM_SAMPLES]{};
+    reader.read((void*) &samples, &count);
+
+    ASSERT_EQ(count, NUM_SAMPLES);
+    for (SizeT i = 0; i < NUM_SAMPLES; ++i)
+        ASSERT_EQ(samples[i], static_cast<double>(dataPtr[i]));
+}
+
+TEST_F(StreamReaderConversionTest, ReadLinearScaled)
+{
+    const auto scaling = LinearScaling(0.5, 3.0, SampleType::Int16, ScaledSampleType::Float64);
+    this->signal.setDescriptor(setupDescriptor(SampleType::Float64, nullptr, scaling));
+
+    auto doubleReader = daq::StreamReader<double, ClockRange>(this->signal);
+    auto floatReader = daq::StreamReader<float, ClockRange>(this->signal);
+    auto rawReader = daq::StreamReader<int16_t, ClockRange>(this->signal, ReadMode::Unscaled);
+
+    const SizeT NUM_SAMPLES = 37;
+    auto dataPacket = DataPacket(this->signal.getDescriptor(), NUM_SAMPLES);
+    auto rawPtr = static_cast<int16_t*>(dataPacket.getRawData());
+    for (SizeT i = 0; i < NUM_SAMPLES; ++i)
+        rawPtr[i] = static_cast<int16_t>(static_cast<int>(i) * 1000 - 15000);
+
+    this->sendPacket(dataPacket);
+
+    SizeT count{NUM_SAMPLES};
+    double doubleSamples[NUM_SAMPLES]{};
+    doubleReader.read((void*) &doubleSamples, &count);
+    ASSERT_EQ(count, NUM_SAMPLES);
+
+    count = NUM_SAMPLES;
+    float floatSamples[NUM_SAMPLES]{};
+    floatReader.read((void*) &floatSamples, &count);
+    ASSERT_EQ(count, NUM_SAMPLES);
+
+    count = NUM_SAMPLES;
+    int16_t rawSamples[NUM_SAMPLES]{};
+    rawReader.read((void*) &rawSamples, &count);
+    ASSERT_EQ(count, NUM_SAMPLES);
+
+    // The readers scale the raw data themselves, which must match the data scaled by the packet
+    auto scaledPtr = static_cast<double*>(dataPacket.getData());
+    for (SizeT i = 0; i < NUM_SAMPLES; ++i)
+    {
+        ASSERT_EQ(doubleSamples[i], scaledPtr[i]);
+        ASSERT_EQ(floatSamples[i], static_cast<float>(scaledPtr[i]));
+        ASSERT_EQ(rawSamples[i], rawPtr[i]);
+    }
+}
+
 TYPED_TEST(StreamReaderTest, DescriptorChangedConvertible)
 {
     this->signal.setDescriptor(setupDescriptor(SampleType::Float64));
@@ -1054,4 +1054,89 @@ TEST_F(TailReaderTest, TailReaderFromExistingOnReadCallback)
     ASSERT_EQ(promiseStatus, std::future_status::ready);
 
     ASSERT_EQ(count, HISTORY_SIZE);
-}
\ No newline at end of file
+}
+TEST_F(TailReaderTest, RingBufferRollingDomain)
+{
+    this->signal.setDescriptor(setupDescriptor(SampleType::Int64));
+
+    constexpr auto HISTORY_SIZE = 5u;
+    auto reader = TailReaderEx<double, ClockTick>(this->signal, HISTORY_SIZE, true);
+
+    auto sendSamples = [this](SizeT sampleCount, Int start)
+    {
+        auto domainPacket = DataPacket(setupDescriptor(SampleType::Int64, LinearDataRule(1, 0), nullptr), sampleCount, start);
+        auto dataPacket = DataPacketWithDomain(domainPacket, this->signal.getDescriptor(), sampleCount);
+        auto dataPtr = static_cast<Int*>(dataPacket.getData());
+        for (SizeT i = 0; i < sampleCount; ++i)
+            dataPtr[i] = start + static_cast<Int>(i);
+
+        this->sendPacket(dataPacket);
+    };
+
+    sendSamples(3, 0);
+    ASSERT_EQ(reader.getAvailableCount(), 3u);
+
+    // Wraps around the end of the buffer
+    sendSamples(4, 3);
+    ASSERT_EQ(reader.getAvailableCount(), HISTORY_SIZE);
+
+    SizeT count{HISTORY_SIZE};
+    double values[HISTORY_SIZE]{};
+    ClockTick domain[HISTORY_SIZE]{};
+    auto status = reader.readWithDomain(&values, &domain, &count);
+
+    ASSERT_EQ(status.getReadStatus(), ReadStatus::Ok);
+    ASSERT_EQ(count, HISTORY_SIZE);
+    for (SizeT i = 0; i < HISTORY_SIZE; ++i)
+    {
+        ASSERT_EQ(values[i], 2.0 + i);
+        ASSERT_EQ(domain[i], 2 + static_cast<ClockTick>(i));
+    }
+
+    // Only the last samples of a packet larger than the history are kept
+    sendSamples(12, 7);
+
+    count = 2;
+    reader.read(&values, &count);
+    ASSERT_EQ(count, 2u);
+    ASSERT_EQ(values[0], 17.0);
+    ASSERT_EQ(values[1], 18.0);
+
+    count = HISTORY_SIZE + 1;
+    ASSERT_THROW(reader.read(&values, &count), SizeTooLargeException);
+}
+
+TEST_F(TailReaderTest, RingBufferDescriptorChanged)
+{
+    this->signal.setDescriptor(setupDescriptor(SampleType::Int32));
+
+    constexpr auto HISTORY_SIZE = 4u;
+    auto reader = TailReaderEx(this->signal, HISTORY_SIZE, SampleType::Float64, SampleType::Int64, ReadMode::Scaled, true);
+
+    auto dataPacket = DataPacket(this->signal.getDescriptor(), 2);
+    auto dataPtr = static_cast<int32_t*>(dataPacket.getData());
+    dataPtr[0] = 1;
+    dataPtr[1] = 2;
+    this->sendPacket(dataPacket);
+
+    this->signal.setDescriptor(setupDescriptor(SampleType::Float32));
+    ASSERT_EQ(reader.getAvailableCount(), 0u);
+
+    auto newDataPacket = DataPacket(this->signal.getDescriptor(), 1);
+    static_cast<float*>(newDataPacket.getData())[0] = 3.5f;
+    this->sendPacket(newDataPacket);
+
+    SizeT count{HISTORY_SIZE};
+    double values[HISTORY_SIZE]{};
+    auto status = reader.read(&values, &count);
+
+    ASSERT_EQ(status.getReadStatus(), ReadStatus::Event);
+    ASSERT_TRUE(status.getValid());
+    ASSERT_EQ(count, 0u);
+
+    count = HISTORY_SIZE;
+    status = reader.read(&values, &count);
+    ASSERT_EQ(status.getReadStatus(), ReadStatus::Ok);
+    ASSERT_EQ(count, 1u);
+    ASSERT_EQ(values[0], 3.5);
+}
@@ -73,6 +73,12 @@ DECLARE_OPENDAQ_INTERFACE(IScheduler, IBaseObject)
      * @param[out] multiThreaded Returns @c true if more that one worker thread is used by the scheduler.
      */
     virtual ErrCode INTERFACE_FUNC isMultiThreaded(Bool* multiThreaded) = 0;
+
+    /*!
+     * @brief Gets the number of worker threads used by the scheduler.
+     * @param[out] count The number of worker threads.
+     */
+    virtual ErrCode INTERFACE_FUNC getWorkerCount(SizeT* count) = 0;
 };
 /*!@}*/
 
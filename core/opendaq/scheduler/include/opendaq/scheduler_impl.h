@@ -35,6 +35,7 @@ public:
     ErrCode INTERFACE_FUNC scheduleWork(IFunction* task, IAwaitable** awaitable) override;
     ErrCode INTERFACE_FUNC scheduleGraph(ITaskGraph* graph, IAwaitable** awaitable) override;
     ErrCode INTERFACE_FUNC isMultiThreaded(Bool* multiThreaded) override;
+    ErrCode INTERFACE_FUNC getWorkerCount(SizeT* count) override;
 
     ErrCode INTERFACE_FUNC stop() override;
     ErrCode INTERFACE_FUNC waitAll() override;
@@ -113,6 +113,17 @@ ErrCode SchedulerImpl::isMultiThreaded(Bool* multiThreaded)
     return OPENDAQ_SUCCESS;
 }
 
+ErrCode SchedulerImpl::getWorkerCount(SizeT* count)
+{
+    if (count == nullptr)
+    {
+        return OPENDAQ_ERR_ARGUMENT_NULL;
+    }
+
+    *count = executor->num_workers();
+    return OPENDAQ_SUCCESS;
+}
+
 std::size_t SchedulerImpl::getWorkerCount() const
 {
     return executor->num_workers();
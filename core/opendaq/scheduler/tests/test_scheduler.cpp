@@ -36,6 +36,12 @@ TEST_F(SchedulerTestCommon, SingleThreaded)
     ASSERT_FALSE(scheduler.isMultiThreaded());
 }
 
+TEST_F(SchedulerTestCommon, WorkerCount)
+{
+    auto scheduler = Scheduler(Logger(), 3);
+    ASSERT_EQ(scheduler.getWorkerCount(), 3u);
+}
+
 TEST_F(SchedulerTestCommon, GraphExceptionsMaskedByDefault)
 {
     auto root = TaskGraph([]() {
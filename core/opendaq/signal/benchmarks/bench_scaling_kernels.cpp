@@ -0,0 +1,172 @@
+#include <opendaq/scaling_kernels.h>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace daq;
+
+namespace
+{
+
+constexpr SizeT SampleCount = 64 * 1024;
+constexpr int Iterations = 2000;
+
+const char* getLevelName(SimdLevel level)
+{
+    switch (level)
+    {
+        case SimdLevel::Scalar:
+            return "scalar";
+        case SimdLevel::Neon:
+            return "neon";
+        case SimdLevel::Avx2:
+            return "avx2";
+        case SimdLevel::Avx512:
+            return "avx512";
+    }
+    return "unknown";
+}
+
+template <typename Func>
+double measureSamplesPerSecond(Func&& func)
+{
+    func();
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < Iterations; ++i)
+        func();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    return static_cast<double>(SampleCount) * Iterations / elapsed.count();
+}
+
+template <typename T, typename U>
+void benchmarkScaling(const std::string& name)
+{
+    std::vector<T> input(SampleCount);
+    for (SizeT i = 0; i < SampleCount; ++i)
+        input[i] = static_cast<T>(i % 100);
+    std::vector<U> output(SampleCount);
+
+    const U scale = static_cast<U>(0.5);
+    const U offset = static_cast<U>(1.5);
+
+    // Kept out of line so the compiler does not vectorize the baseline itself
+    volatile SizeT count = SampleCount;
+    const double scalar = measureSamplesPerSecond([&] {
+        const SizeT n = count;
+        for (SizeT i = 0; i < n; ++i)
+            output[i] = scale * static_cast<U>(input[i]) + offset;
+    });
+
+    std::cout << std::left << std::setw(24) << ("scale " + name) << std::setw(10) << "scalar" << std::fixed << std::setprecision(1)
+              << scalar / 1e6 << " MS/s" << std::endl;
+
+    for (auto level : {SimdLevel::Neon, SimdLevel::Avx2, SimdLevel::Avx512})
+    {
+        if (level > getSimdLevel() || (getSimdLevel() != SimdLevel::Neon && level == SimdLevel::Neon))
+            continue;
+
+        const auto kernel = getLinearScaleKernel<T, U>(level);
+        if (!kernel)
+            continue;
+
+        const double vectorized = measureSamplesPerSecond([&] { kernel(input.data(), output.data(), SampleCount, scale, offset); });
+        std::cout << std::left << std::setw(24) << ("scale " + name) << std::setw(10) << getLevelName(level) << vectorized / 1e6
+                  << " MS/s (x" << std::setprecision(2) << vectorized / scalar << std::setprecision(1) << ")" << std::endl;
+    }
+}
+
+template <typename T, typename U>
+void benchmarkConversion(const std::string& name)
+{
+    std::vector<T> input(SampleCount);
+    for (SizeT i = 0; i < SampleCount; ++i)
+        input[i] = static_cast<T>(i % 100);
+    std::vector<U> output(SampleCount);
+
+    volatile SizeT count = SampleCount;
+    const double scalar = measureSamplesPerSecond([&] {
+        const SizeT n = count;
+        for (SizeT i = 0; i < n; ++i)
+            output[i] = static_cast<U>(input[i]);
+    });
+
+    std::cout << std::left << std::setw(24) << ("convert " + name) << std::setw(10) << "scalar" << std::fixed << std::setprecision(1)
+              << scalar / 1e6 << " MS/s" << std::endl;
+
+    for (auto level : {SimdLevel::Neon, SimdLevel::Avx2, SimdLevel::Avx512})
+    {
+        if (level > getSimdLevel() || (getSimdLevel() != SimdLevel::Neon && level == SimdLevel::Neon))
+            continue;
+
+        const auto kernel = getConvertKernel<T, U>(level);
+        if (!kernel)
+            continue;
+
+        const double vectorized = measureSamplesPerSecond([&] { kernel(input.data(), output.data(), SampleCount); });
+        std::cout << std::left << std::setw(24) << ("convert " + name) << std::setw(10) << getLevelName(level) << vectorized / 1e6
+                  << " MS/s (x" << std::setprecision(2) << vectorized / scalar << std::setprecision(1) << ")" << std::endl;
+    }
+}
+
+template <typename T>
+void benchmarkRule(const std::string& name)
+{
+    std::vector<T> output(SampleCount);
+    const T delta = static_cast<T>(3);
+    const T offset = static_cast<T>(100);
+
+    volatile SizeT count = SampleCount;
+    const double scalar = measureSamplesPerSecond([&] {
+        const SizeT n = count;
+        for (SizeT i = 0; i < n; ++i)
+            output[i] = delta * static_cast<T>(i) + offset;
+    });
+
+    std::cout << std::left << std::setw(24) << ("rule " + name) << std::setw(10) << "scalar" << std::fixed << std::setprecision(1)
+              << scalar / 1e6 << " MS/s" << std::endl;
+
+    for (auto level : {SimdLevel::Neon, SimdLevel::Avx2, SimdLevel::Avx512})
+    {
+        if (level > getSimdLevel() || (getSimdLevel() != SimdLevel::Neon && level == SimdLevel::Neon))
+            continue;
+
+        const auto kernel = getLinearRuleKernel<T>(level);
+        if (!kernel)
+            continue;
+
+        const double vectorized = measureSamplesPerSecond([&] { kernel(output.data(), SampleCount, delta, offset); });
+        std::cout << std::left << std::setw(24) << ("rule " + name) << std::setw(10) << getLevelName(level) << vectorized / 1e6
+                  << " MS/s (x" << std::setprecision(2) << vectorized / scalar << std::setprecision(1) << ")" << std::endl;
+    }
+}
+
+}
+
+int main()
+{
+    std::cout << "Detected instruction set: " << getLevelName(getSimdLevel()) << std::endl << std::endl;
+
+    benchmarkScaling<int16_t, float>("int16 -> float");
+    benchmarkScaling<int16_t, double>("int16 -> double");
+    benchmarkScaling<int32_t, double>("int32 -> double");
+    benchmarkScaling<uint32_t, float>("uint32 -> float");
+    benchmarkScaling<int64_t, double>("int64 -> double");
+    benchmarkScaling<float, float>("float -> float");
+    benchmarkScaling<double, double>("double -> double");
+
+    benchmarkConversion<int16_t, double>("int16 -> double");
+    benchmarkConversion<int32_t, double>("int32 -> double");
+    benchmarkConversion<int16_t, float>("int16 -> float");
+    benchmarkConversion<int16_t, int32_t>("int16 -> int32");
+
+    benchmarkRule<int64_t>("int64");
+    benchmarkRule<double>("double");
+    benchmarkRule<float>("float");
+
+    return 0;
+}
@@ -87,4 +87,11 @@ OPENDAQ_DECLARE_CLASS_FACTORY_WITH_INTERFACE(
     IDeleter*, deleter
 )
 
+OPENDAQ_DECLARE_CLASS_FACTORY_WITH_INTERFACE(
+    LIBRARY_FACTORY, PoolAllocator,
+    IAllocator,
+    SizeT, alignment,
+    SizeT, maxCachedBuffers
+)
+
 END_NAMESPACE_OPENDAQ
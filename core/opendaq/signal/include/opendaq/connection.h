@@ -114,6 +114,33 @@ DECLARE_OPENDAQ_INTERFACE(IConnection, IBaseObject)
      * on remote devices.
      */
     virtual ErrCode INTERFACE_FUNC isRemote(Bool* remote) = 0;
+
+    // [elementType(packets, IPacket)]
+    /*!
+     * @brief Places multiple packets at the back of the queue.
+     * @param packets The packets to be enqueued.
+     *
+     * The listener is notified only once, after all packets have been enqueued.
+     */
+    virtual ErrCode INTERFACE_FUNC enqueueMultiple(IList* packets) = 0;
+
+    // [elementType(packets, IPacket)]
+    /*!
+     * @brief Removes all packets from the queue and returns them.
+     * @param[out] packets The removed packets in queue order. Empty if the connection has no packets.
+     *
+     * The packets are removed in a single operation, which is cheaper than calling `dequeue`
+     * for each of them.
+     */
+    virtual ErrCode INTERFACE_FUNC dequeueAll(IList** packets) = 0;
+
+    // [elementType(packets, IPacket)]
+    /*!
+     * @brief Removes up to @p count packets from the front of the queue and returns them.
+     * @param count The maximum number of packets to remove.
+     * @param[out] packets The removed packets in queue order. Empty if the connection has no packets.
+     */
+    virtual ErrCode INTERFACE_FUNC dequeueUpTo(SizeT count, IList** packets) = 0;
 };
 /*!@}*/
 
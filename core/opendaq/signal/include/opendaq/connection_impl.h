@@ -20,12 +20,12 @@
 #include <opendaq/context_ptr.h>
 #include <coretypes/intfs.h>
 #include <coretypes/weakrefobj.h>
+#include <coretypes/listptr.h>
+#include <opendaq/spsc_queue.h>
 
-#ifdef OPENDAQ_THREAD_SAFE
-    #include <mutex>
-#endif
-
-#include <queue>
+#include <atomic>
+#include <deque>
+#include <mutex>
 
 BEGIN_NAMESPACE_OPENDAQ
 
@@ -51,7 +51,9 @@ public:
 
     ErrCode INTERFACE_FUNC isRemote(Bool* remote) override;
 
-    [[nodiscard]] const std::deque<PacketPtr>& getPackets() const noexcept;
+    ErrCode INTERFACE_FUNC enqueueMultiple(IList* packets) override;
+    ErrCode INTERFACE_FUNC dequeueAll(IList** packets) override;
+    ErrCode INTERFACE_FUNC dequeueUpTo(SizeT count, IList** packets) override;
 
 #ifdef OPENDAQ_THREAD_SAFE
     template <typename Func>
@@ -60,25 +62,65 @@ public:
         std::lock_guard guard(mutex);
         return func();
     }
+
+    template <typename Func>
+    auto withProducerLock(Func&& func) const
+    {
+        std::lock_guard guard(producerMutex);
+        return func();
+    }
 #else
     template <typename Func>
     auto withLock(Func&& func) const
     {
         return func();
     }
+
+    template <typename Func>
+    auto withProducerLock(Func&& func) const
+    {
+        return func();
+    }
 #endif
 
+protected:
+    struct QueuedPacket
+    {
+        PacketPtr packet;
+        SizeT sampleCount{};
+        bool descriptorChanged{};
+    };
+
+    QueuedPacket makeQueuedPacket(IPacket* packet);
+    void pushQueuedPacket(QueuedPacket&& queued);
+    void enqueueInternal(IPacket* packet);
+    void enqueueMultipleInternal(const ListPtr<IPacket>& packetList);
+    bool dequeueInternal(PacketPtr& packet);
+    ListPtr<IPacket> dequeueMultipleInternal(SizeT maxCount);
+
 private:
     InputPortConfigPtr port;
     WeakRefPtr<ISignal> signalRef;
     ContextPtr context;
 
 #ifdef OPENDAQ_THREAD_SAFE
+    // Guards the consumer side of the queue (dequeue, peek)
     mutable std::mutex mutex;
+    // Guards the producer side of the queue (enqueue); never taken together with the consumer lock
+    mutable std::mutex producerMutex;
 #endif
 
-protected:
-    std::deque<PacketPtr> packets;
+    SpscQueue<QueuedPacket> packets;
+
+    // Running sample counters, kept so that sample queries do not need to walk the queue
+    std::atomic<SizeT> availableSamples{0};
+    SizeT enqueuedSamples{0};
+    SizeT dequeuedSamples{0};
+
+    // Values of `enqueuedSamples` at which data-descriptor-changed events were enqueued
+    std::atomic<SizeT> pendingDescriptorChanges{0};
+    std::mutex descriptorMarksMutex;
+    std::deque<SizeT> descriptorMarks;
 };
 
 END_NAMESPACE_OPENDAQ
@@ -0,0 +1,67 @@
+/*
+ * Copyright 2022-2023 Blueberry d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <coretypes/common.h>
+#include <opendaq/connection_ptr.h>
+#include <opendaq/packet_ptr.h>
+#include <exception>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @brief Removes the packets queued in the connection and passes them to @p process in queue order.
+ * @param connection The connection to take the packets from.
+ * @param process Callable invoked with each packet as `process(const PacketPtr&)`.
+ *
+ * A single queued packet is taken with `dequeue`, several with one `dequeueAll` call, so the list is only
+ * allocated when there is a batch to process. If @p process throws, the remaining packets of the batch are
+ * still processed and the first exception is rethrown afterwards, so that no dequeued packet is lost.
+ */
+template <typename Func>
+void processQueuedPackets(const ConnectionPtr& connection, Func&& process)
+{
+    const SizeT packetCount = connection.getPacketCount();
+    if (packetCount == 0)
+        return;
+
+    if (packetCount == 1)
+    {
+        const auto packet = connection.dequeue();
+        if (packet.assigned())
+            process(packet);
+        return;
+    }
+
+    std::exception_ptr error;
+    for (const auto& packet : connection.dequeueAll())
+    {
+        try
+        {
+            process(packet);
+        }
+        catch (...)
+        {
+            if (!error)
+                error = std::current_exception();
+        }
+    }
+
+    if (error)
+        std::rethrow_exception(error);
+}
+
+END_NAMESPACE_OPENDAQ
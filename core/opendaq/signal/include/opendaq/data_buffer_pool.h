@@ -0,0 +1,104 @@
+/*
+ * Copyright 2022-2023 Blueberry d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <coretypes/common.h>
+#include <array>
+#include <cstdlib>
+#include <mutex>
+#include <vector>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @brief Recycles buffers used for scaled and rule-calculated packet data.
+ *
+ * Buffers are grouped into power-of-two size classes. Released buffers are kept in a per-class free list
+ * (up to `MaxBuffersPerClass`) and handed out again by later allocations of the same class, so reading
+ * a steady stream of packets with the same sample count does not allocate once the lists are warm.
+ */
+class DataBufferPool
+{
+public:
+    static constexpr SizeT MinBufferSize = 64;
+    static constexpr SizeT MaxBuffersPerClass = 16;
+
+    DataBufferPool() = default;
+    DataBufferPool(const DataBufferPool&) = delete;
+    DataBufferPool& operator=(const DataBufferPool&) = delete;
+
+    ~DataBufferPool()
+    {
+        for (auto& freeList : freeLists)
+            for (void* buffer : freeList)
+                std::free(buffer);
+    }
+
+    void* allocate(SizeT bytes)
+    {
+        const SizeT sizeClass = getSizeClass(bytes);
+        {
+            std::scoped_lock lock(sync);
+            auto& freeList = freeLists[sizeClass];
+            if (!freeList.empty())
+            {
+                void* buffer = freeList.back();
+                freeList.pop_back();
+                return buffer;
+            }
+        }
+
+        return std::malloc(getClassSize(sizeClass));
+    }
+
+    void free(void* buffer, SizeT bytes)
+    {
+        if (!buffer)
+            return;
+
+        const SizeT sizeClass = getSizeClass(bytes);
+        {
+            std::scoped_lock lock(sync);
+            auto& freeList = freeLists[sizeClass];
+            if (freeList.size() < MaxBuffersPerClass)
+            {
+                freeList.push_back(buffer);
+                return;
+            }
+        }
+
+        std::free(buffer);
+    }
+
+private:
+    static SizeT getSizeClass(SizeT bytes)
+    {
+        SizeT sizeClass = 0;
+        while (getClassSize(sizeClass) < bytes)
+            ++sizeClass;
+        return sizeClass;
+    }
+
+    static SizeT getClassSize(SizeT sizeClass)
+    {
+        return MinBufferSize << sizeClass;
+    }
+
+    std::mutex sync;
+    std::array<std::vector<void*>, 58> freeLists;
+};
+
+END_NAMESPACE_OPENDAQ
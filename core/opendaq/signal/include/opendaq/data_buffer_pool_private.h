@@ -0,0 +1,52 @@
+/*
+ * Copyright 2022-2023 Blueberry d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <coretypes/baseobject.h>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @ingroup opendaq_data_descriptor
+ * @addtogroup opendaq_data_buffer_pool Data buffer pool
+ * @{
+ */
+
+/*!
+ * @brief Internal functions used by openDAQ core. This interface should never be used in
+ * client SDK or module code.
+ *
+ * Provides buffers for the scaled or rule-calculated data of packets that share the data descriptor.
+ */
+DECLARE_OPENDAQ_INTERFACE(IDataBufferPoolPrivate, IBaseObject)
+{
+    /*!
+     * @brief Gets a buffer of at least the requested size for scaled or calculated packet data.
+     * @param bytes The required size of the buffer in bytes.
+     * @returns A pointer to the buffer, or nullptr if out of memory.
+     */
+    virtual void* INTERFACE_FUNC allocateDataBuffer(SizeT bytes) = 0;
+
+    /*!
+     * @brief Returns a buffer obtained with `allocateDataBuffer`.
+     * @param buffer The buffer. Calls with a null buffer are ignored.
+     * @param bytes The size that was requested when the buffer was allocated.
+     */
+    virtual void INTERFACE_FUNC freeDataBuffer(void* buffer, SizeT bytes) = 0;
+};
+/*!@}*/
+
+END_NAMESPACE_OPENDAQ
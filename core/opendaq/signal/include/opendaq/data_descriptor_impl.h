@@ -19,6 +19,8 @@
 #include <coretypes/listobject_factory.h>
 #include <coretypes/struct_impl.h>
 #include <opendaq/data_descriptor_builder_ptr.h>
+#include <opendaq/data_buffer_pool.h>
+#include <opendaq/data_buffer_pool_private.h>
 #include <opendaq/data_descriptor_ptr.h>
 #include <opendaq/data_rule_calc.h>
 #include <opendaq/data_rule_calc_private.h>
@@ -28,7 +30,7 @@
 
 BEGIN_NAMESPACE_OPENDAQ
 
-class DataDescriptorImpl : public GenericStructImpl<IDataDescriptor, IStruct, IScalingCalcPrivate, IDataRuleCalcPrivate>
+class DataDescriptorImpl : public GenericStructImpl<IDataDescriptor, IStruct, IScalingCalcPrivate, IDataRuleCalcPrivate, IDataBufferPoolPrivate>
 {
 public:
     explicit DataDescriptorImpl(IDataDescriptorBuilder* dataDescriptorBuilder);
@@ -59,6 +61,10 @@ public:
     void INTERFACE_FUNC calculateRule(const NumberPtr& packetOffset, SizeT sampleCount, void** output) const override;
     bool INTERFACE_FUNC hasDataRuleCalc() const override;
 
+    // IDataBufferPoolPrivate
+    void* INTERFACE_FUNC allocateDataBuffer(SizeT bytes) override;
+    void INTERFACE_FUNC freeDataBuffer(void* buffer, SizeT bytes) override;
+
     // ISerializable
     ErrCode INTERFACE_FUNC serialize(ISerializer* serializer) override;
     ErrCode INTERFACE_FUNC getSerializeId(ConstCharPtr* id) const override;
@@ -87,6 +93,7 @@ private:
     void initCalcs();
     std::unique_ptr<ScalingCalc> scalingCalc;
     std::unique_ptr<DataRuleCalc> dataRuleCalc;
+    std::unique_ptr<DataBufferPool> dataBufferPool;
     SizeT sampleSize;
     SizeT rawSampleSize;
 
@@ -17,9 +17,11 @@
 #pragma once
 #include <coretypes/intfs.h>
 #include <opendaq/allocator_ptr.h>
+#include <opendaq/data_buffer_pool_private.h>
 #include <opendaq/data_descriptor_ptr.h>
 #include <opendaq/data_rule_calc_private.h>
 #include <opendaq/generic_data_packet_impl.h>
+#include <opendaq/packet_recycler_private.h>
 #include <opendaq/range_factory.h>
 #include <opendaq/sample_type_traits.h>
 #include <opendaq/scaling_calc_private.h>
@@ -37,10 +39,13 @@ public:
                             const DataDescriptorPtr& descriptor,
                             SizeT sampleCount,
                             const NumberPtr& offset,
-                            AllocatorPtr allocator);
+                            AllocatorPtr allocator,
+                            IPacketRecyclerPrivate* recycler = nullptr);
     explicit DataPacketImpl(const DataDescriptorPtr& descriptor, SizeT sampleCount, const NumberPtr& offset, AllocatorPtr allocator);
     ~DataPacketImpl() override;
 
+    int INTERFACE_FUNC releaseRef() override;
+
     ErrCode INTERFACE_FUNC getDataDescriptor(IDataDescriptor** descriptor) override;
     ErrCode INTERFACE_FUNC getSampleCount(SizeT* sampleCount) override;
     ErrCode INTERFACE_FUNC getOffset(INumber** offset) override;
@@ -52,7 +57,20 @@ public:
 
     ErrCode INTERFACE_FUNC equals(IBaseObject* other, Bool* equals) const override;
 
+    // Re-initializes a packet that was returned to its recycler; keeps the raw data buffer if the size matches
+    void reuse(const DataPacketPtr& domainPacket,
+               const DataDescriptorPtr& descriptor,
+               SizeT sampleCount,
+               const NumberPtr& offset,
+               IPacketRecyclerPrivate* recycler);
+
+    // Disposes and deletes a packet with no references left, as a packet without a recycler is on its last release
+    void destroyUnreferenced();
+
 private:
+    void initialize();
+    void releaseForRecycling();
+    void freeRawData();
     bool isDataEqual(const DataPacketPtr& dataPacket) const;
 
     AllocatorPtr allocator;
@@ -70,6 +88,8 @@ private:
     bool hasScalingCalc;
     bool hasDataRuleCalc;
     bool hasRawDataOnly;
+
+    ObjectPtr<IPacketRecyclerPrivate> recycler;
 };
 
 template <typename TInterface>
@@ -77,28 +97,61 @@ DataPacketImpl<TInterface>::DataPacketImpl(const DataPacketPtr& domainPacket,
                                            const DataDescriptorPtr& descriptor,
                                            SizeT sampleCount,
                                            const NumberPtr& offset,
-                                           AllocatorPtr allocator)
+                                           AllocatorPtr allocator,
+                                           IPacketRecyclerPrivate* recycler)
     : GenericDataPacketImpl<TInterface>(domainPacket)
     , allocator(std::move(allocator))
     , descriptor(descriptor)
     , sampleCount(sampleCount)
     , offset(offset)
-    , hasScalingCalc(false)
-    , hasDataRuleCalc(false)
-    , hasRawDataOnly(true)
+    , rawDataSize(0)
+    , data(nullptr)
+    , scaledData(nullptr)
+    , recycler(recycler)
 {
-    scaledData = nullptr;
-    data = nullptr;
+    initialize();
+}
+
+template <typename TInterface>
+DataPacketImpl<TInterface>::DataPacketImpl(const DataDescriptorPtr& descriptor,
+                                           SizeT sampleCount,
+                                           const NumberPtr& offset,
+                                           AllocatorPtr allocator)
+    : DataPacketImpl<TInterface>(nullptr, descriptor, sampleCount, offset, std::move(allocator))
+{
+}
+
+template <typename TInterface>
+DataPacketImpl<TInterface>::~DataPacketImpl()
+{
+    freeRawData();
+
+    if (scaledData)
+        descriptor.asPtr<IDataBufferPoolPrivate>(false)->freeDataBuffer(scaledData, dataSize);
+}
+
+template <typename TInterface>
+void DataPacketImpl<TInterface>::initialize()
+{
+    hasScalingCalc = false;
+    hasDataRuleCalc = false;
+    hasRawDataOnly = true;
 
     if (!descriptor.assigned())
         throw ArgumentNullException("Data descriptor in packet is null.");
 
+    const SizeT allocatedSize = rawDataSize;
+
     sampleSize = descriptor.getSampleSize();
     rawSampleSize = descriptor.getRawSampleSize();
     dataSize = sampleCount * sampleSize;
     rawDataSize = sampleCount * rawSampleSize;
 
-    if (rawDataSize > 0)
+    // A recycled packet keeps its buffer when the size of the data does not change
+    if (data != nullptr && allocatedSize != rawDataSize)
+        freeRawData();
+
+    if (data == nullptr && rawDataSize > 0)
     {
         if (this->allocator.assigned())
             data = this->allocator.allocate(descriptor, rawDataSize, rawSampleSize);
@@ -123,16 +176,7 @@ DataPacketImpl<TInterface>::DataPacketImpl(const DataPacketPtr& domainPacket,
 }
 
 template <typename TInterface>
-DataPacketImpl<TInterface>::DataPacketImpl(const DataDescriptorPtr& descriptor,
-                                           SizeT sampleCount,
-                                           const NumberPtr& offset,
-                                           AllocatorPtr allocator)
-    : DataPacketImpl<TInterface>(nullptr, descriptor, sampleCount, offset, std::move(allocator))
-{
-}
-
-template <typename TInterface>
-DataPacketImpl<TInterface>::~DataPacketImpl()
+void DataPacketImpl<TInterface>::freeRawData()
 {
     if (allocator.assigned())
     {
@@ -142,7 +186,70 @@ DataPacketImpl<TInterface>::~DataPacketImpl()
     {
         std::free(data);
     }
-    std::free(scaledData);
+
+    data = nullptr;
+}
+
+template <typename TInterface>
+int DataPacketImpl<TInterface>::releaseRef()
+{
+    if (!recycler.assigned())
+        return Super::releaseRef();
+
+    const auto newRefCount = this->internalReleaseRef();
+    assert(newRefCount >= 0);
+    if (newRefCount == 0)
+    {
+        // The recycler can be destroyed together with the packet, so it is kept alive until the packet is handed over
+        ObjectPtr<IPacketRecyclerPrivate> packetRecycler = std::move(recycler);
+        releaseForRecycling();
+
+        if (!packetRecycler->recyclePacket(this))
+            destroyUnreferenced();
+    }
+
+    return newRefCount;
+}
+
+template <typename TInterface>
+void DataPacketImpl<TInterface>::destroyUnreferenced()
+{
+    this->checkAndCallDispose();
+    delete this;
+}
+
+template <typename TInterface>
+void DataPacketImpl<TInterface>::releaseForRecycling()
+{
+    this->notifyPacketDestroyed();
+
+    if (scaledData)
+    {
+        descriptor.asPtr<IDataBufferPoolPrivate>(false)->freeDataBuffer(scaledData, dataSize);
+        scaledData = nullptr;
+    }
+
+    this->domainPacket.release();
+    descriptor.release();
+    offset.release();
+}
+
+template <typename TInterface>
+void DataPacketImpl<TInterface>::reuse(const DataPacketPtr& domainPacket,
+                                       const DataDescriptorPtr& descriptor,
+                                       SizeT sampleCount,
+                                       const NumberPtr& offset,
+                                       IPacketRecyclerPrivate* recycler)
+{
+    this->domainPacket = domainPacket;
+    this->packetId = generatePacketId();
+    this->descriptor = descriptor;
+    this->sampleCount = sampleCount;
+    this->offset = offset;
+
+    initialize();
+
+    this->recycler = recycler;
 }
 
 template <typename TInterface>
@@ -206,15 +313,26 @@ ErrCode DataPacketImpl<TInterface>::getData(void** address)
             daqTry(
                 [&]()
                 {
-                    if (hasScalingCalc)
+                    // Buffers come from the descriptor's pool, so steady-state reading does not allocate
+                    const auto bufferPool = descriptor.asPtr<IDataBufferPoolPrivate>(false);
+                    void* buffer = bufferPool->allocateDataBuffer(dataSize);
+                    if (!buffer)
+                        throw NoMemoryException("Memory allocation failed.");
+
+                    try
                     {
-                        scaledData = descriptor.asPtr<IScalingCalcPrivate>(false)->scaleData(data, sampleCount);
+                        if (hasScalingCalc)
+                            descriptor.asPtr<IScalingCalcPrivate>(false)->scaleData(data, sampleCount, &buffer);
+                        else if (hasDataRuleCalc)
+                            descriptor.asPtr<IDataRuleCalcPrivate>(false)->calculateRule(offset, sampleCount, &buffer);
                     }
-                    else if (hasDataRuleCalc)
+                    catch (...)
                     {
-                        scaledData = descriptor.asPtr<IDataRuleCalcPrivate>(false)->calculateRule(offset, sampleCount);
+                        bufferPool->freeDataBuffer(buffer, dataSize);
+                        throw;
                     }
 
+                    scaledData = buffer;
                     *address = scaledData;
                     return OPENDAQ_SUCCESS;
                 });
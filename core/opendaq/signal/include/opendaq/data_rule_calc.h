@@ -19,6 +19,7 @@
 #include <opendaq/signal_exceptions.h>
 #include <opendaq/range_type.h>
 #include <opendaq/sample_type_traits.h>
+#include <opendaq/scaling_kernels.h>
 
 BEGIN_NAMESPACE_OPENDAQ
 
@@ -62,13 +63,25 @@ private:
 
     DataRuleType type;
     std::vector<T> parameters;
+    LinearRuleKernel<T> linearKernel;
 };
 
 template <typename T>
 DataRuleCalcTyped<T>::DataRuleCalcTyped(const DataRulePtr& rule)
+    : linearKernel(nullptr)
 {
     type = rule.getType();
     parameters = ParseRuleParameters(rule.getParameters(), type);
+
+    if constexpr (std::is_arithmetic_v<T>)
+    {
+        if (type == DataRuleType::Linear)
+        {
+            linearKernel = getLinearRuleKernel<T>();
+            if (!linearKernel)
+                linearKernel = getScalarLinearRuleKernel<T>();
+        }
+    }
 }
 
 template <typename T>
@@ -207,6 +220,14 @@ void DataRuleCalcTyped<T>::calculateLinearRule(const NumberPtr& packetOffset, Si
     T* outputTyped = static_cast<T*>(*output);
     const T scale = parameters[0];
     const T offset = static_cast<T>(packetOffset) + parameters[1];
+
+    if (linearKernel)
+    {
+        linearKernel(outputTyped, sampleCount, scale, offset);
+        return;
+    }
+
+    // Range types have no kernels
     for (SizeT i = 0; i < sampleCount; ++i)
         outputTyped[i] = scale * static_cast<T>(i) + offset;
 }
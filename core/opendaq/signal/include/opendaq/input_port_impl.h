@@ -27,6 +27,7 @@
 #include <opendaq/signal_errors.h>
 #include <opendaq/signal_events_ptr.h>
 #include <opendaq/signal_factory.h>
+#include <atomic>
 
 BEGIN_NAMESPACE_OPENDAQ
 
@@ -64,6 +65,7 @@ public:
 
     // IInputPortPrivate
     ErrCode INTERFACE_FUNC disconnectWithoutSignalNotification() override;
+    ErrCode INTERFACE_FUNC getListener(IInputPortNotifications** listener) override;
 
     // IRemovable
     ErrCode INTERFACE_FUNC remove() override;
@@ -98,6 +100,16 @@ protected:
     StringPtr serializedSignalId;
 
 private:
+    // Tracks the scheduler notification task of the port: at most one is in flight, and packets enqueued
+    // while it runs request another pass instead of another task
+    enum class SchedulerNotificationState
+    {
+        Idle,
+        Scheduled,
+        Rescheduled
+    };
+    using SchedulerNotificationStatePtr = std::shared_ptr<std::atomic<SchedulerNotificationState>>;
+
     Bool requiresSignal;
     BaseObjectPtr customData;
     PacketReadyNotification notifyMethod{};
@@ -106,6 +118,7 @@ private:
     WeakRefPtr<IConnection> connectionRef{};
     bool isInputPortRemoved;
     FunctionPtr notifySchedulerCallback;
+    SchedulerNotificationStatePtr schedulerNotificationState;
 
     LoggerComponentPtr loggerComponent;
     SchedulerPtr scheduler;
@@ -134,6 +147,7 @@ GenericInputPortImpl<Interfaces ...>::GenericInputPortImpl(const ContextPtr& con
     , listenerRef(nullptr)
     , connectionRef(nullptr)
     , isInputPortRemoved(false)
+    , schedulerNotificationState(std::make_shared<std::atomic<SchedulerNotificationState>>(SchedulerNotificationState::Idle))
 {
     loggerComponent = context.getLogger().getOrAddComponent("InputPort");
     if (context.assigned())
@@ -397,7 +411,34 @@ void GenericInputPortImpl<Interfaces...>::notifyPacketEnqueuedSameThread()
 template <class... Interfaces>
 void GenericInputPortImpl<Interfaces...>::notifyPacketEnqueuedScheduler()
 {
-    scheduler.scheduleWork(notifySchedulerCallback);
+    if (!notifySchedulerCallback.assigned())
+        return;
+
+    auto state = schedulerNotificationState->load(std::memory_order_acquire);
+    while (true)
+    {
+        if (state == SchedulerNotificationState::Rescheduled)
+            return;
+
+        const auto newState = state == SchedulerNotificationState::Idle ? SchedulerNotificationState::Scheduled
+                                                                        : SchedulerNotificationState::Rescheduled;
+        if (schedulerNotificationState->compare_exchange_weak(state, newState, std::memory_order_acq_rel))
+            break;
+    }
+
+    // The task in flight picks up the packet on its next pass
+    if (state != SchedulerNotificationState::Idle)
+        return;
+
+    try
+    {
+        scheduler.scheduleWork(notifySchedulerCallback);
+    }
+    catch (...)
+    {
+        schedulerNotificationState->store(SchedulerNotificationState::Idle, std::memory_order_release);
+        throw;
+    }
 }
 
 template <class... Interfaces>
@@ -452,12 +493,24 @@ ErrCode GenericInputPortImpl<Interfaces...>::setListener(IInputPortNotifications
     if (listenerRef.assigned())
     {
         auto portRef = this->template getWeakRefInternal<IInputPort>();
-        notifySchedulerCallback = [notifyRef = listenerRef, portRef = portRef, loggerComponent = loggerComponent]
+        notifySchedulerCallback = [notifyRef = listenerRef,
+                                   portRef = portRef,
+                                   loggerComponent = loggerComponent,
+                                   state = schedulerNotificationState]
         {
-            auto notify = notifyRef.getRef();
-            auto port = portRef.getRef();
-            if (notify.assigned() && port.assigned())
+            // The listener drains the connection, so one pass covers every packet enqueued before it started
+            while (true)
             {
+                state->store(SchedulerNotificationState::Scheduled, std::memory_order_release);
+
+                auto notify = notifyRef.getRef();
+                auto port = portRef.getRef();
+                if (!notify.assigned() || !port.assigned())
+                {
+                    state->store(SchedulerNotificationState::Idle, std::memory_order_release);
+                    return false;
+                }
+
                 try
                 {
                     notify.packetReceived(port);
@@ -466,9 +519,11 @@ ErrCode GenericInputPortImpl<Interfaces...>::setListener(IInputPortNotifications
                 {
                     LOG_E("Input port notification failed: {}", e.what());
                 }
-                return true;
+
+                auto expected = SchedulerNotificationState::Scheduled;
+                if (state->compare_exchange_strong(expected, SchedulerNotificationState::Idle, std::memory_order_acq_rel))
+                    return true;
             }
-            return false;
         };
     }
     else
@@ -510,6 +565,17 @@ ErrCode GenericInputPortImpl<Interfaces...>::disconnectWithoutSignalNotification
         });
 }
 
+template <class... Interfaces>
+ErrCode GenericInputPortImpl<Interfaces...>::getListener(IInputPortNotifications** listener)
+{
+    OPENDAQ_PARAM_NOT_NULL(listener);
+
+    std::scoped_lock lock(this->sync);
+
+    *listener = listenerRef.assigned() ? listenerRef.getRef().detach() : nullptr;
+    return OPENDAQ_SUCCESS;
+}
+
 template <class... Interfaces>
 void GenericInputPortImpl<Interfaces...>::finishUpdate()
 {
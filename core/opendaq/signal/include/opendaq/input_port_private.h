@@ -17,6 +17,7 @@
 #pragma once
 
 #include <coretypes/baseobject.h>
+#include <opendaq/input_port_notifications.h>
 
 BEGIN_NAMESPACE_OPENDAQ
 
@@ -36,6 +37,12 @@ DECLARE_OPENDAQ_INTERFACE(IInputPortPrivate, IBaseObject)
      * @brief Disconnects the signal without notification to the signal.
      */
     virtual ErrCode INTERFACE_FUNC disconnectWithoutSignalNotification() = 0;
+
+    /*!
+     * @brief Gets the object receiving input-port related events and notifications.
+     * @param[out] listener The listener set with `setListener`, or nullptr if none is set or it was released.
+     */
+    virtual ErrCode INTERFACE_FUNC getListener(IInputPortNotifications** listener) = 0;
 };
 /*!@}*/
 
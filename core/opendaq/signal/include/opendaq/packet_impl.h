@@ -37,6 +37,8 @@ public:
     ErrCode INTERFACE_FUNC equals(IBaseObject* other, Bool* equals) const override;
 
 protected:
+    void notifyPacketDestroyed();
+
     PacketType type;
     std::mutex sync;
     std::vector<PacketDestructCallbackPtr> packetDestructCallbackList;
@@ -50,9 +52,17 @@ PacketImpl<TInterface, TInterfaces ...>::PacketImpl()
 
 template <typename TInterface, typename ... TInterfaces>
 PacketImpl<TInterface, TInterfaces...>::~PacketImpl()
+{
+    notifyPacketDestroyed();
+}
+
+template <typename TInterface, typename ... TInterfaces>
+void PacketImpl<TInterface, TInterfaces...>::notifyPacketDestroyed()
 {
     for (const auto& packetDestructCallback : packetDestructCallbackList)
         packetDestructCallback->onPacketDestroyed();
+
+    packetDestructCallbackList.clear();
 }
 
 template <typename TInterface, typename... TInterfaces>
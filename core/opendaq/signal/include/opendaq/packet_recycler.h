@@ -0,0 +1,84 @@
+/*
+ * Copyright 2022-2023 Blueberry d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <coretypes/baseobject.h>
+#include <opendaq/allocator.h>
+#include <opendaq/data_descriptor.h>
+#include <opendaq/data_packet.h>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*#
+ * [interfaceSmartPtr(IDataPacket, DataPacketPtr, "<opendaq/data_packet_ptr.h>")]
+ */
+
+/*!
+ * @ingroup opendaq_packets
+ * @addtogroup opendaq_packet_recycler Packet recycler
+ * @{
+ */
+
+/*!
+ * @brief Creates Data packets and reuses the packet objects once they are no longer referenced.
+ *
+ * When the last reference to a packet created by the recycler is released, the packet object and its
+ * buffer are returned to the recycler instead of being destroyed. Subsequent packets are created by
+ * re-initializing a returned object, avoiding the allocation of a new packet object and, if the size of
+ * the data does not change, of a new buffer. Packet destruct callbacks are invoked when the packet is
+ * returned to the recycler.
+ *
+ * A recycler is intended to be owned by a single signal, so that the returned packets usually match the
+ * size of the next packet. Packets keep the recycler alive until they are returned.
+ */
+DECLARE_OPENDAQ_INTERFACE(IPacketRecycler, IBaseObject)
+{
+    // [templateType(packet, IDataPacket)]
+    /*!
+     * @brief Creates a Data packet, reusing a returned packet object if one is available.
+     * @param domainPacket The OPTIONAL Data packet carrying domain data.
+     * @param descriptor The descriptor of the signal sending the data.
+     * @param sampleCount The number of samples in the packet.
+     * @param offset Optional packet offset parameter, used to calculate the data of the packet
+     * if the Data rule of the Signal descriptor is not explicit.
+     * @param[out] packet The created Data packet.
+     */
+    virtual ErrCode INTERFACE_FUNC createDataPacket(IDataPacket* domainPacket,
+                                                    IDataDescriptor* descriptor,
+                                                    SizeT sampleCount,
+                                                    INumber* offset,
+                                                    IDataPacket** packet) = 0;
+
+    /*!
+     * @brief Gets the number of returned packet objects that are available for reuse.
+     * @param[out] count The number of cached packet objects.
+     */
+    virtual ErrCode INTERFACE_FUNC getCachedPacketCount(SizeT* count) = 0;
+
+    /*!
+     * @brief Destroys all cached packet objects and their buffers.
+     */
+    virtual ErrCode INTERFACE_FUNC clear() = 0;
+};
+/*!@}*/
+
+OPENDAQ_DECLARE_CLASS_FACTORY(
+    LIBRARY_FACTORY, PacketRecycler,
+    SizeT, maxCachedPackets,
+    IAllocator*, allocator
+)
+
+END_NAMESPACE_OPENDAQ
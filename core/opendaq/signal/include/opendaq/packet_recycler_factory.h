@@ -0,0 +1,85 @@
+/*
+ * Copyright 2022-2023 Blueberry d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <opendaq/packet_recycler_ptr.h>
+#include <opendaq/data_packet_ptr.h>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @ingroup opendaq_packet_recycler
+ * @addtogroup opendaq_packet_recycler_factories Factories
+ * @{
+ */
+
+/*!
+ * @brief Creates a packet recycler that reuses the objects and buffers of Data packets once they are released.
+ * @param maxCachedPackets The maximum number of released packet objects kept for reuse. Additional packets are destroyed.
+ * @param allocator An optional memory allocator to use for packet buffers.
+ *
+ * A recycler should be owned by a single signal and used to create all of its Data packets.
+ */
+inline PacketRecyclerPtr PacketRecycler(SizeT maxCachedPackets = 64, AllocatorPtr allocator = nullptr)
+{
+    PacketRecyclerPtr obj(PacketRecycler_Create(maxCachedPackets, allocator));
+    return obj;
+}
+
+/*!
+ * @brief Creates a Data packet with a given descriptor, sample count and an optional packet offset,
+ * reusing a packet object released to the recycler if one is available.
+ * @param recycler The recycler owned by the signal sending the data.
+ * @param descriptor The descriptor of the signal sending the data.
+ * @param sampleCount The number of samples in the packet.
+ * @param offset Optional packet offset parameter, used to calculate the data of the packet
+ * if the Data rule of the Signal descriptor is not explicit.
+ */
+inline DataPacketPtr RecycledDataPacket(const PacketRecyclerPtr& recycler,
+                                        const DataDescriptorPtr& descriptor,
+                                        uint64_t sampleCount,
+                                        const NumberPtr& offset = nullptr)
+{
+    DataPacketPtr obj;
+    checkErrorInfo(recycler->createDataPacket(nullptr, descriptor, sampleCount, offset, &obj));
+    return obj;
+}
+
+/*!
+ * @brief Creates a Data packet with a given descriptor, sample count, a reference to a packet that
+ * describes the domain (time) data and an optional packet offset, reusing a packet object released
+ * to the recycler if one is available.
+ * @param recycler The recycler owned by the signal sending the data.
+ * @param domainPacket The Data packet carrying domain data.
+ * @param descriptor The descriptor of the signal sending the data.
+ * @param sampleCount The number of samples in the packet.
+ * @param offset Optional packet offset parameter, used to calculate the data of the packet
+ * if the Data rule of the Signal descriptor is not explicit.
+ */
+inline DataPacketPtr RecycledDataPacketWithDomain(const PacketRecyclerPtr& recycler,
+                                                  const DataPacketPtr& domainPacket,
+                                                  const DataDescriptorPtr& descriptor,
+                                                  uint64_t sampleCount,
+                                                  const NumberPtr& offset = nullptr)
+{
+    DataPacketPtr obj;
+    checkErrorInfo(recycler->createDataPacket(domainPacket, descriptor, sampleCount, offset, &obj));
+    return obj;
+}
+
+/*!@}*/
+
+END_NAMESPACE_OPENDAQ
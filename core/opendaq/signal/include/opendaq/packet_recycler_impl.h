@@ -0,0 +1,63 @@
+/*
+ * Copyright 2022-2023 Blueberry d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <opendaq/allocator_ptr.h>
+#include <opendaq/data_packet_impl.h>
+#include <opendaq/packet_recycler.h>
+#include <opendaq/packet_recycler_private.h>
+#include <coretypes/intfs.h>
+#include <mutex>
+#include <vector>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @brief Keeps a free list of Data packet objects that are no longer referenced.
+ *
+ * At most `maxCachedPackets` objects are kept; packets returned to a full free list are destroyed.
+ * Buffers of packets created by the recycler are allocated with the recycler's allocator, or with
+ * `malloc` if no allocator is assigned.
+ */
+class PacketRecyclerImpl : public ImplementationOf<IPacketRecycler, IPacketRecyclerPrivate>
+{
+public:
+    explicit PacketRecyclerImpl(SizeT maxCachedPackets, IAllocator* allocator);
+    ~PacketRecyclerImpl() override;
+
+    ErrCode INTERFACE_FUNC createDataPacket(IDataPacket* domainPacket,
+                                            IDataDescriptor* descriptor,
+                                            SizeT sampleCount,
+                                            INumber* offset,
+                                            IDataPacket** packet) override;
+    ErrCode INTERFACE_FUNC getCachedPacketCount(SizeT* count) override;
+    ErrCode INTERFACE_FUNC clear() override;
+
+    Bool INTERFACE_FUNC recyclePacket(IDataPacket* packet) override;
+
+private:
+    using Packet = DataPacketImpl<IDataPacket>;
+
+    Packet* takeCachedPacket();
+
+    const SizeT maxCachedPackets;
+    AllocatorPtr allocator;
+
+    std::mutex sync;
+    std::vector<Packet*> freeList;
+};
+
+END_NAMESPACE_OPENDAQ
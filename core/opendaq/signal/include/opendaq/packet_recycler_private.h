@@ -0,0 +1,46 @@
+/*
+ * Copyright 2022-2023 Blueberry d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <coretypes/baseobject.h>
+#include <opendaq/data_packet.h>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @ingroup opendaq_packet_recycler
+ * @addtogroup opendaq_packet_recycler_private Packet recycler private
+ * @{
+ */
+
+/*!
+ * @brief Internal functions used by openDAQ core. This interface should never be used in
+ * client SDK or module code.
+ *
+ * Takes back packets created by a packet recycler when their last reference is released.
+ */
+DECLARE_OPENDAQ_INTERFACE(IPacketRecyclerPrivate, IBaseObject)
+{
+    /*!
+     * @brief Returns a packet with no remaining references to the recycler.
+     * @param packet The packet. It must have been created by the recycler.
+     * @returns True if the recycler took ownership of the packet; false if the caller must destroy it.
+     */
+    virtual Bool INTERFACE_FUNC recyclePacket(IDataPacket* packet) = 0;
+};
+/*!@}*/
+
+END_NAMESPACE_OPENDAQ
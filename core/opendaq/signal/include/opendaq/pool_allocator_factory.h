@@ -0,0 +1,36 @@
+/*
+ * Copyright 2022-2023 Blueberry d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <opendaq/allocator_ptr.h>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @brief Creates an allocator that recycles packet buffers of the same size.
+ * @param alignment The alignment of every buffer in bytes. Must be a power of two (eg. 64 for a cache line or 4096 for a page).
+ * @param maxCachedBuffers The maximum number of freed buffers kept for each buffer size. Additional buffers are released.
+ *
+ * The allocator exposes its statistics as the read-only "Hits", "Misses", "BytesInUse" and "HighWaterMark"
+ * properties, accessible through the `IPropertyObject` interface.
+ */
+inline AllocatorPtr PoolAllocator(SizeT alignment = 64, SizeT maxCachedBuffers = 16)
+{
+    AllocatorPtr obj(PoolAllocator_Create(alignment, maxCachedBuffers));
+    return obj;
+}
+
+END_NAMESPACE_OPENDAQ
@@ -0,0 +1,77 @@
+/*
+ * Copyright 2022-2023 Blueberry d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <opendaq/allocator.h>
+#include <opendaq/data_descriptor.h>
+#include <coreobjects/property_object_impl.h>
+#include <coretypes/common.h>
+#include <coretypes/intfs.h>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @brief Allocator that recycles packet buffers of the same size.
+ *
+ * Freed buffers are kept in free lists keyed by their size in bytes (sample size × sample count) and
+ * are handed out again by allocations of the same size. All buffers are aligned to the alignment
+ * given on creation (typically a cache line or a page).
+ *
+ * Statistics are available as read-only properties:
+ *  - "Hits": the number of allocations served from a free list,
+ *  - "Misses": the number of allocations that required new memory,
+ *  - "BytesInUse": the number of bytes currently allocated and not yet freed,
+ *  - "HighWaterMark": the highest value of "BytesInUse" so far.
+ */
+class PoolAllocatorImpl : public GenericPropertyObjectImpl<IPropertyObject, IAllocator>
+{
+public:
+    using Super = GenericPropertyObjectImpl<IPropertyObject, IAllocator>;
+
+    explicit PoolAllocatorImpl(SizeT alignment, SizeT maxCachedBuffers);
+    ~PoolAllocatorImpl() override;
+
+    ErrCode INTERFACE_FUNC allocate(
+        const IDataDescriptor *descriptor,
+        daq::SizeT bytes,
+        daq::SizeT align,
+        VoidPtr* address) override;
+
+    ErrCode INTERFACE_FUNC free(VoidPtr address) override;
+
+private:
+    void initProperties();
+    void addStatisticProperty(const StringPtr& name, const SizeT& value);
+
+    void* allocateBlock(SizeT bytes) const;
+    void freeBlock(void* address) const;
+    static SizeT& getBlockSize(void* address);
+
+    const SizeT alignment;
+    const SizeT maxCachedBuffers;
+
+    std::mutex sync;
+    std::unordered_map<SizeT, std::vector<void*>> freeLists;
+    SizeT hits;
+    SizeT misses;
+    SizeT bytesInUse;
+    SizeT highWaterMark;
+};
+
+END_NAMESPACE_OPENDAQ
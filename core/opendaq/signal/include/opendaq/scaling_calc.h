@@ -18,6 +18,7 @@
 #include <opendaq/scaling_ptr.h>
 #include <opendaq/signal_exceptions.h>
 #include <opendaq/sample_type_traits.h>
+#include <opendaq/scaling_kernels.h>
 
 BEGIN_NAMESPACE_OPENDAQ
 
@@ -55,10 +56,12 @@ private:
 
     ScalingType type;
     std::vector<U> params;
+    LinearScaleKernel<T, U> linearKernel;
 };
 
 template <typename T, typename U>
 ScalingCalcTyped<T, U>::ScalingCalcTyped(const ScalingPtr& scaling)
+    : linearKernel(nullptr)
 {
     type = scaling.getType();
     if (type == ScalingType::Linear)
@@ -67,6 +70,9 @@ ScalingCalcTyped<T, U>::ScalingCalcTyped(const ScalingPtr& scaling)
         U offset = scaling.getParameters().get("offset");
         params.push_back(scale);
         params.push_back(offset);
+        linearKernel = getLinearScaleKernel<T, U>();
+        if (!linearKernel)
+            linearKernel = getScalarLinearScaleKernel<T, U>();
     }
 }
 
@@ -109,8 +115,8 @@ void ScalingCalcTyped<T, U>::scaleLinear(void* data, SizeT sampleCount, void** o
     U* scaledData = static_cast<U*>(*output);
     const U scale = params[0];
     const U offset = params[1];
-    for (SizeT i = 0; i < sampleCount; ++i)
-        scaledData[i] = scale * static_cast<U>(rawData[i]) + offset;
+
+    linearKernel(rawData, scaledData, sampleCount, scale, offset);
 }
 
 static ScalingCalc* createScalingCalcTyped(const ScalingPtr& scaling)
@@ -0,0 +1,103 @@
+/*
+ * Copyright 2022-2023 Blueberry d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <coretypes/common.h>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @brief Instruction set used by the vectorized scaling and data rule kernels.
+ */
+enum class SimdLevel
+{
+    Scalar = 0,
+    Neon,
+    Avx2,
+    Avx512
+};
+
+/*!
+ * @brief Gets the best instruction set supported by both the build and the CPU the process runs on.
+ * The CPU is queried only on the first call.
+ */
+SimdLevel getSimdLevel();
+
+/*!
+ * @brief Computes `output[i] = scale * U(input[i]) + offset`.
+ */
+template <typename T, typename U>
+using LinearScaleKernel = void (*)(const T* input, U* output, SizeT sampleCount, U scale, U offset);
+
+/*!
+ * @brief Computes `output[i] = delta * T(i) + offset`.
+ */
+template <typename T>
+using LinearRuleKernel = void (*)(T* output, SizeT sampleCount, T delta, T offset);
+
+/*!
+ * @brief Computes `output[i] = static_cast<U>(input[i])`.
+ */
+template <typename T, typename U>
+using ConvertKernel = void (*)(const T* input, U* output, SizeT sampleCount);
+
+/*!
+ * @brief Gets a vectorized linear scaling kernel for the given instruction set.
+ * @returns The kernel, or nullptr if there is no kernel for the type combination and the scalar loop should be used.
+ *
+ * Kernels produce the same results as the scalar `scale * static_cast<U>(value) + offset` expression.
+ * Instantiated for all integer and floating-point input types and float/double output types.
+ */
+template <typename T, typename U>
+LinearScaleKernel<T, U> getLinearScaleKernel(SimdLevel level = getSimdLevel());
+
+/*!
+ * @brief Gets a vectorized linear data rule kernel for the given instruction set.
+ * @returns The kernel, or nullptr if there is no kernel for the type and the scalar loop should be used.
+ *
+ * Instantiated for all integer and floating-point output types.
+ */
+template <typename T>
+LinearRuleKernel<T> getLinearRuleKernel(SimdLevel level = getSimdLevel());
+
+/*!
+ * @brief Gets the scalar linear scaling loop, used when getLinearScaleKernel returns nullptr.
+ *
+ * The loop is compiled together with the vectorized kernels, without contracting the multiply-add,
+ * so it rounds the same way as the kernels. Instantiated for the same types as getLinearScaleKernel.
+ */
+template <typename T, typename U>
+LinearScaleKernel<T, U> getScalarLinearScaleKernel();
+
+/*!
+ * @brief Gets the scalar linear data rule loop, used when getLinearRuleKernel returns nullptr.
+ *
+ * Instantiated for the same types as getLinearRuleKernel.
+ */
+template <typename T>
+LinearRuleKernel<T> getScalarLinearRuleKernel();
+
+/*!
+ * @brief Gets a vectorized sample type conversion kernel for the given instruction set.
+ * @returns The kernel, or nullptr if there is no kernel for the type combination and the scalar loop should be used.
+ *
+ * Kernels exist for conversions to float/double and for widening integer conversions, and produce the same
+ * results as `static_cast<U>(value)`. Instantiated for all pairs of integer and floating-point types.
+ */
+template <typename T, typename U>
+ConvertKernel<T, U> getConvertKernel(SimdLevel level = getSimdLevel());
+
+END_NAMESPACE_OPENDAQ
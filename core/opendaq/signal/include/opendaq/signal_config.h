@@ -96,6 +96,16 @@ DECLARE_OPENDAQ_INTERFACE(ISignalConfig, ISignal)
      * @param packet The packet to be sent.
      */
     virtual ErrCode INTERFACE_FUNC sendPacket(IPacket* packet) = 0;
+
+    // [elementType(packets, IPacket)]
+    /*!
+     * @brief Sends multiple packets through all connections of the signal.
+     * @param packets The packets to be sent.
+     *
+     * The packets are enqueued into each connection in a single operation, and each connection
+     * notifies its listener only once for the whole batch.
+     */
+    virtual ErrCode INTERFACE_FUNC sendPackets(IList* packets) = 0;
 };
 /*!@}*/
 
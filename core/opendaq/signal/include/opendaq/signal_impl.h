@@ -83,6 +83,7 @@ public:
     ErrCode INTERFACE_FUNC removeRelatedSignal(ISignal* signal) override;
     ErrCode INTERFACE_FUNC clearRelatedSignals() override;
     ErrCode INTERFACE_FUNC sendPacket(IPacket* packet) override;
+    ErrCode INTERFACE_FUNC sendPackets(IList* packets) override;
 
     // ISignalEvents
     ErrCode INTERFACE_FUNC listenerConnected(IConnection* connection) override;
@@ -136,6 +137,7 @@ private:
     DataPacketPtr lastDataPacket;
 
     bool sendPacketInternal(const PacketPtr& packet, bool ignoreActive = false) const;
+    bool sendPacketsInternal(const ListPtr<IPacket>& packets) const;
     void triggerRelatedSignalsChanged();
     void disconnectInputPort(const ConnectionPtr& connection);
     void clearConnections(std::vector<ConnectionPtr>& connections);
@@ -510,6 +512,54 @@ ErrCode SignalBase<TInterface, Interfaces...>::sendPacket(IPacket* packet)
     return  OPENDAQ_IGNORED;
 }
 
+template <typename TInterface, typename... Interfaces>
+ErrCode SignalBase<TInterface, Interfaces...>::sendPackets(IList* packets)
+{
+    OPENDAQ_PARAM_NOT_NULL(packets);
+
+    const auto packetsPtr = ListPtr<IPacket>::Borrow(packets);
+    if (packetsPtr.getCount() == 0)
+        return OPENDAQ_SUCCESS;
+
+    for (const auto& packet : packetsPtr)
+        OPENDAQ_PARAM_NOT_NULL(packet.getObject());
+
+    std::scoped_lock lock(this->sync);
+
+    return daqTry([&packetsPtr, this]()
+    {
+        if (!sendPacketsInternal(packetsPtr))
+            return OPENDAQ_IGNORED;
+
+        if (keepLastPacket)
+        {
+            for (SizeT i = packetsPtr.getCount(); i > 0; --i)
+            {
+                const auto dataPacket = packetsPtr.getItemAt(i - 1).asPtrOrNull<IDataPacket>();
+                if (dataPacket.assigned() && dataPacket.getSampleCount())
+                {
+                    lastDataPacket = dataPacket;
+                    break;
+                }
+            }
+        }
+
+        return OPENDAQ_SUCCESS;
+    });
+}
+
+template <typename TInterface, typename... Interfaces>
+bool SignalBase<TInterface, Interfaces...>::sendPacketsInternal(const ListPtr<IPacket>& packets) const
+{
+    if (!this->active)
+        return false;
+
+    for (auto& connection : connections)
+        connection.enqueueMultiple(packets);
+
+    return true;
+}
+
 template <typename TInterface, typename... Interfaces>
 bool SignalBase<TInterface, Interfaces...>::sendPacketInternal(const PacketPtr& packet, bool ignoreActive) const
 {
@@ -16,8 +16,12 @@
 
 #pragma once
 #include <coretypes/common.h>
+#include <coretypes/list_factory.h>
+#include <algorithm>
+#include <vector>
 #include <opendaq/sample_type.h>
 #include <opendaq/signal_ptr.h>
+#include <opendaq/signal_config_ptr.h>
 #include <opendaq/data_descriptor_ptr.h>
 
 BEGIN_NAMESPACE_OPENDAQ
@@ -40,4 +44,40 @@ inline daq::ErrCode getSignalSampleType(const daq::SignalPtr& signal, daq::Sampl
     return descriptor->getSampleType(sampleType);
 }
 
+/*!
+ * @brief Sends the packets of several signals, one batch per signal.
+ * @param signalPackets Pairs of a signal and the packets to be sent through it.
+ *
+ * Meant for devices that produce packets for several signals per acquisition cycle (e.g. a domain
+ * signal and its value signals). The packets of entries with the same signal are merged in the given
+ * order, so each signal is locked once and each of its connections is notified once. Signals are sent
+ * in the order of their first entry.
+ */
+inline void sendPacketsToSignals(const std::vector<std::pair<SignalConfigPtr, ListPtr<IPacket>>>& signalPackets)
+{
+    std::vector<std::pair<SignalConfigPtr, ListPtr<IPacket>>> batches;
+    batches.reserve(signalPackets.size());
+
+    for (const auto& [signal, packets] : signalPackets)
+    {
+        auto batch = std::find_if(batches.begin(),
+                                  batches.end(),
+                                  [&signal](const std::pair<SignalConfigPtr, ListPtr<IPacket>>& entry)
+                                  {
+                                      return entry.first.getObject() == signal.getObject();
+                                  });
+        if (batch == batches.end())
+        {
+            batches.emplace_back(signal, List<IPacket>());
+            batch = std::prev(batches.end());
+        }
+
+        for (const auto& packet : packets)
+            batch->second.pushBack(packet);
+    }
+
+    for (const auto& [signal, packets] : batches)
+        signal.sendPackets(packets);
+}
+
 END_NAMESPACE_OPENDAQ
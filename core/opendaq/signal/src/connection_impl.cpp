@@ -3,6 +3,11 @@
 #include <opendaq/data_packet_ptr.h>
 #include <opendaq/event_packet_ids.h>
 #include <opendaq/event_packet_ptr.h>
+#include <coretypes/listptr.h>
+#include <coretypes/list_factory.h>
+#include <algorithm>
+#include <limits>
+#include <vector>
 
 BEGIN_NAMESPACE_OPENDAQ
 ConnectionImpl::ConnectionImpl(const InputPortPtr& port, const SignalPtr& signal, ContextPtr context)
@@ -12,14 +17,142 @@ ConnectionImpl::ConnectionImpl(const InputPortPtr& port, const SignalPtr& signal
 {
 }
 
-ErrCode ConnectionImpl::enqueue(IPacket* packet)
+ConnectionImpl::QueuedPacket ConnectionImpl::makeQueuedPacket(IPacket* packet)
 {
-    OPENDAQ_PARAM_NOT_NULL(packet);
+    QueuedPacket queued{PacketPtr(packet)};
+
+    const auto dataPacket = queued.packet.asPtrOrNull<IDataPacket>(true);
+    if (dataPacket.assigned())
+    {
+        queued.sampleCount = dataPacket.getSampleCount();
+    }
+    else
+    {
+        const auto eventPacket = queued.packet.asPtrOrNull<IEventPacket>(true);
+        queued.descriptorChanged = eventPacket.assigned() && eventPacket.getEventId() == event_packet_id::DATA_DESCRIPTOR_CHANGED;
+    }
+
+    return queued;
+}
+
+void ConnectionImpl::pushQueuedPacket(QueuedPacket&& queued)
+{
+    if (queued.descriptorChanged)
+    {
+        std::scoped_lock lock(descriptorMarksMutex);
+        descriptorMarks.push_back(enqueuedSamples);
+        pendingDescriptorChanges.fetch_add(1, std::memory_order_release);
+    }
+
+    // Counters are incremented before the packet becomes visible to the consumer so they never underflow
+    enqueuedSamples += queued.sampleCount;
+    availableSamples.fetch_add(queued.sampleCount, std::memory_order_release);
+    packets.push(std::move(queued));
+}
+
+void ConnectionImpl::enqueueInternal(IPacket* packet)
+{
+    auto queued = makeQueuedPacket(packet);
+    withProducerLock([&queued, this]() { pushQueuedPacket(std::move(queued)); });
+}
+
+void ConnectionImpl::enqueueMultipleInternal(const ListPtr<IPacket>& packetList)
+{
+    std::vector<QueuedPacket> queuedPackets;
+    queuedPackets.reserve(packetList.getCount());
 
-    withLock([&packet, this]()
+    SizeT sampleCount = 0;
+    for (const auto& packet : packetList)
     {
-        packets.emplace_back(packet);
+        queuedPackets.push_back(makeQueuedPacket(packet));
+        sampleCount += queuedPackets.back().sampleCount;
+    }
+
+    withProducerLock([&queuedPackets, sampleCount, this]()
+    {
+        {
+            std::scoped_lock lock(descriptorMarksMutex);
+            SizeT markSamples = enqueuedSamples;
+            SizeT descriptorChanges = 0;
+            for (const auto& queued : queuedPackets)
+            {
+                if (queued.descriptorChanged)
+                {
+                    descriptorMarks.push_back(markSamples);
+                    ++descriptorChanges;
+                }
+                markSamples += queued.sampleCount;
+            }
+
+            if (descriptorChanges > 0)
+                pendingDescriptorChanges.fetch_add(descriptorChanges, std::memory_order_release);
+        }
+
+        // Counters are incremented before the packets become visible to the consumer so they never underflow
+        enqueuedSamples += sampleCount;
+        availableSamples.fetch_add(sampleCount, std::memory_order_release);
+        for (auto& queued : queuedPackets)
+            packets.push(std::move(queued));
     });
+}
+
+bool ConnectionImpl::dequeueInternal(PacketPtr& packet)
+{
+    QueuedPacket queued;
+    if (!packets.pop(queued))
+        return false;
+
+    if (queued.descriptorChanged)
+    {
+        std::scoped_lock lock(descriptorMarksMutex);
+        descriptorMarks.pop_front();
+        pendingDescriptorChanges.fetch_sub(1, std::memory_order_release);
+    }
+
+    dequeuedSamples += queued.sampleCount;
+    availableSamples.fetch_sub(queued.sampleCount, std::memory_order_release);
+    packet = std::move(queued.packet);
+    return true;
+}
+
+ListPtr<IPacket> ConnectionImpl::dequeueMultipleInternal(SizeT maxCount)
+{
+    auto result = List<IPacket>();
+
+    // Packets enqueued while draining are left for the next call so a busy producer cannot keep the consumer here
+    const SizeT count = std::min(maxCount, static_cast<SizeT>(packets.size()));
+    if (count == 0)
+        return result;
+
+    SizeT sampleCount = 0;
+    SizeT descriptorChanges = 0;
+    QueuedPacket queued;
+    for (SizeT i = 0; i < count && packets.pop(queued); ++i)
+    {
+        sampleCount += queued.sampleCount;
+        if (queued.descriptorChanged)
+            ++descriptorChanges;
+
+        result.pushBack(std::move(queued.packet));
+    }
+
+    if (descriptorChanges > 0)
+    {
+        std::scoped_lock lock(descriptorMarksMutex);
+        descriptorMarks.erase(descriptorMarks.begin(), descriptorMarks.begin() + descriptorChanges);
+        pendingDescriptorChanges.fetch_sub(descriptorChanges, std::memory_order_release);
+    }
+
+    dequeuedSamples += sampleCount;
+    availableSamples.fetch_sub(sampleCount, std::memory_order_release);
+    return result;
+}
+
+ErrCode ConnectionImpl::enqueue(IPacket* packet)
+{
+    OPENDAQ_PARAM_NOT_NULL(packet);
+
+    enqueueInternal(packet);
 
     port.notifyPacketEnqueued();
     return OPENDAQ_SUCCESS;
@@ -29,30 +162,68 @@ ErrCode INTERFACE_FUNC ConnectionImpl::enqueueOnThisThread(IPacket* packet)
 {
     OPENDAQ_PARAM_NOT_NULL(packet);
 
-    withLock([&packet, this]()
-    {
-        packets.emplace_back(packet);
-    });
+    enqueueInternal(packet);
 
     port.notifyPacketEnqueuedOnThisThread();
     return OPENDAQ_SUCCESS;
 }
 
+ErrCode ConnectionImpl::enqueueMultiple(IList* packets)
+{
+    OPENDAQ_PARAM_NOT_NULL(packets);
+
+    const auto packetsPtr = ListPtr<IPacket>::Borrow(packets);
+    if (packetsPtr.getCount() == 0)
+        return OPENDAQ_SUCCESS;
+
+    for (const auto& packet : packetsPtr)
+    {
+        if (!packet.assigned())
+            return OPENDAQ_ERR_ARGUMENT_NULL;
+    }
+
+    enqueueMultipleInternal(packetsPtr);
+
+    port.notifyPacketEnqueued();
+    return OPENDAQ_SUCCESS;
+}
+
 ErrCode ConnectionImpl::dequeue(IPacket** packet)
 {
     OPENDAQ_PARAM_NOT_NULL(packet);
 
     return withLock([&packet, this]()
     {
-        if (packets.empty())
+        PacketPtr packetPtr;
+        if (!dequeueInternal(packetPtr))
         {
             *packet = nullptr;
             return OPENDAQ_NO_MORE_ITEMS;
         }
 
-        *packet = packets.front().addRefAndReturn();
-        packets.pop_front();
+        *packet = packetPtr.detach();
+        return OPENDAQ_SUCCESS;
+    });
+}
+
+ErrCode ConnectionImpl::dequeueAll(IList** packets)
+{
+    OPENDAQ_PARAM_NOT_NULL(packets);
 
+    return withLock([&packets, this]()
+    {
+        *packets = dequeueMultipleInternal(std::numeric_limits<SizeT>::max()).detach();
+        return OPENDAQ_SUCCESS;
+    });
+}
+
+ErrCode ConnectionImpl::dequeueUpTo(SizeT count, IList** packets)
+{
+    OPENDAQ_PARAM_NOT_NULL(packets);
+
+    return withLock([count, &packets, this]()
+    {
+        *packets = dequeueMultipleInternal(count).detach();
         return OPENDAQ_SUCCESS;
     });
 }
@@ -63,13 +234,14 @@ ErrCode ConnectionImpl::peek(IPacket** packet)
 
     return withLock([&packet, this]()
     {
-        if (packets.empty())
+        const auto front = packets.front();
+        if (front == nullptr)
         {
             *packet = nullptr;
             return OPENDAQ_NO_MORE_ITEMS;
         }
 
-        *packet = packets.front().addRefAndReturn();
+        *packet = front->packet.addRefAndReturn();
         return OPENDAQ_SUCCESS;
     });
 }
@@ -78,69 +250,34 @@ ErrCode ConnectionImpl::getPacketCount(SizeT* packetCount)
 {
     OPENDAQ_PARAM_NOT_NULL(packetCount);
 
-    return withLock([&packetCount, this]()
-    {
-        *packetCount = packets.size();
-        return OPENDAQ_SUCCESS;
-    });
+    *packetCount = packets.size();
+    return OPENDAQ_SUCCESS;
 }
 
 ErrCode ConnectionImpl::getAvailableSamples(SizeT* samples)
 {
     OPENDAQ_PARAM_NOT_NULL(samples);
 
-    return withLock([samples, this]()
-    {
-        *samples = 0;
-        for (const auto& packet : packets)
-        {
-            if (packet.getType() == PacketType::Data)
-            {
-                auto dataPacket = packet.template asPtrOrNull<IDataPacket>(true);
-                if (dataPacket.assigned())
-                {
-                    *samples += dataPacket.getSampleCount();
-                }
-            }
-        }
-
-        return OPENDAQ_SUCCESS;
-    });
+    *samples = availableSamples.load(std::memory_order_acquire);
+    return OPENDAQ_SUCCESS;
 }
 
 ErrCode ConnectionImpl::getSamplesUntilNextDescriptor(SizeT* samples)
 {
     OPENDAQ_PARAM_NOT_NULL(samples);
 
-    return withLock([samples, this]() {
-        *samples = 0;
-        for (const auto& packet : packets)
+    return withLock([samples, this]()
+    {
+        if (pendingDescriptorChanges.load(std::memory_order_acquire) == 0)
         {
-            switch (packet.getType())
-            {
-                case PacketType::Data:
-                {
-                    auto dataPacket = packet.template asPtrOrNull<IDataPacket>(true);
-                    if (dataPacket.assigned())
-                    {
-                        *samples += dataPacket.getSampleCount();
-                    }
-                    break;
-                }
-                case PacketType::Event:
-                {
-                    auto eventPacket = packet.template asPtrOrNull<IEventPacket>(true);
-                    if (eventPacket.getEventId() == event_packet_id::DATA_DESCRIPTOR_CHANGED)
-                    {
-                        return OPENDAQ_SUCCESS;
-                    }
-                    break;
-                }
-                case PacketType::None:
-                    break;
-            }
+            *samples = availableSamples.load(std::memory_order_acquire);
+            return OPENDAQ_SUCCESS;
         }
 
+        std::scoped_lock lock(descriptorMarksMutex);
+        *samples = descriptorMarks.empty()
+            ? availableSamples.load(std::memory_order_acquire)
+            : descriptorMarks.front() - dequeuedSamples;
         return OPENDAQ_SUCCESS;
     });
 }
@@ -171,11 +308,6 @@ ErrCode ConnectionImpl::getInputPort(IInputPort** inputPort)
     return OPENDAQ_SUCCESS;
 }
 
-const std::deque<PacketPtr>& ConnectionImpl::getPackets() const noexcept
-{
-    return packets;
-}
-
 OPENDAQ_DEFINE_CLASS_FACTORY(
     LIBRARY_FACTORY,
     Connection,
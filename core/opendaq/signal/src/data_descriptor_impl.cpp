@@ -37,7 +37,7 @@ DictPtr<IString, IBaseObject> DataDescriptorImpl::PackBuilder(IDataDescriptorBui
 }
 
 DataDescriptorImpl::DataDescriptorImpl(IDataDescriptorBuilder* dataDescriptorBuilder)
-    : GenericStructImpl<IDataDescriptor, IStruct, IScalingCalcPrivate, IDataRuleCalcPrivate>(detail::dataDescriptorStructType, PackBuilder(dataDescriptorBuilder))
+    : GenericStructImpl<IDataDescriptor, IStruct, IScalingCalcPrivate, IDataRuleCalcPrivate, IDataBufferPoolPrivate>(detail::dataDescriptorStructType, PackBuilder(dataDescriptorBuilder))
 {
     const auto dataDescriptorBuilderPtr = DataDescriptorBuilderPtr(dataDescriptorBuilder);
     this->dimensions = dataDescriptorBuilderPtr.getDimensions();
@@ -358,6 +358,23 @@ bool DataDescriptorImpl::hasDataRuleCalc() const
     return (dataRuleCalc != nullptr);
 }
 
+// IDataBufferPoolPrivate
+void* DataDescriptorImpl::allocateDataBuffer(SizeT bytes)
+{
+    if (dataBufferPool)
+        return dataBufferPool->allocate(bytes);
+
+    return std::malloc(bytes);
+}
+
+void DataDescriptorImpl::freeDataBuffer(void* buffer, SizeT bytes)
+{
+    if (dataBufferPool)
+        dataBufferPool->free(buffer, bytes);
+    else
+        std::free(buffer);
+}
+
 void DataDescriptorImpl::initCalcs()
 {
     if (structFields.assigned() && structFields.getCount() != 0)
@@ -368,6 +385,9 @@ void DataDescriptorImpl::initCalcs()
 
     if (scaling.assigned())
         scalingCalc = std::unique_ptr<ScalingCalc>(createScalingCalcTyped(scaling));
+
+    if (scalingCalc || dataRuleCalc)
+        dataBufferPool = std::make_unique<DataBufferPool>();
 }
 
 ErrCode DataDescriptorImpl::serialize(ISerializer* serializer)
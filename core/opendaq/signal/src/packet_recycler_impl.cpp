@@ -0,0 +1,103 @@
+#include <opendaq/packet_recycler_impl.h>
+#include <opendaq/signal_exceptions.h>
+#include <coretypes/impl.h>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+PacketRecyclerImpl::PacketRecyclerImpl(SizeT maxCachedPackets, IAllocator* allocator)
+    : maxCachedPackets(maxCachedPackets)
+    , allocator(allocator)
+{
+    freeList.reserve(maxCachedPackets);
+}
+
+PacketRecyclerImpl::~PacketRecyclerImpl()
+{
+    for (Packet* packet : freeList)
+        packet->destroyUnreferenced();
+}
+
+ErrCode PacketRecyclerImpl::createDataPacket(IDataPacket* domainPacket,
+                                             IDataDescriptor* descriptor,
+                                             SizeT sampleCount,
+                                             INumber* offset,
+                                             IDataPacket** packet)
+{
+    OPENDAQ_PARAM_NOT_NULL(packet);
+
+    Packet* recycled = takeCachedPacket();
+    if (recycled == nullptr)
+        return createObject<IDataPacket, Packet>(packet, domainPacket, descriptor, sampleCount, offset, allocator, this);
+
+    return daqTry(
+        [&]()
+        {
+            try
+            {
+                recycled->reuse(domainPacket, descriptor, sampleCount, offset, this);
+            }
+            catch (...)
+            {
+                recycled->destroyUnreferenced();
+                throw;
+            }
+
+            recycled->addRef();
+            *packet = recycled;
+            return OPENDAQ_SUCCESS;
+        });
+}
+
+ErrCode PacketRecyclerImpl::getCachedPacketCount(SizeT* count)
+{
+    OPENDAQ_PARAM_NOT_NULL(count);
+
+    std::scoped_lock lock(sync);
+    *count = freeList.size();
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode PacketRecyclerImpl::clear()
+{
+    std::vector<Packet*> packets;
+    {
+        std::scoped_lock lock(sync);
+        packets.swap(freeList);
+    }
+
+    for (Packet* packet : packets)
+        packet->destroyUnreferenced();
+
+    return OPENDAQ_SUCCESS;
+}
+
+Bool PacketRecyclerImpl::recyclePacket(IDataPacket* packet)
+{
+    std::scoped_lock lock(sync);
+
+    if (freeList.size() >= maxCachedPackets)
+        return False;
+
+    freeList.push_back(static_cast<Packet*>(packet));
+    return True;
+}
+
+PacketRecyclerImpl::Packet* PacketRecyclerImpl::takeCachedPacket()
+{
+    std::scoped_lock lock(sync);
+
+    if (freeList.empty())
+        return nullptr;
+
+    Packet* packet = freeList.back();
+    freeList.pop_back();
+    return packet;
+}
+
+OPENDAQ_DEFINE_CLASS_FACTORY(
+    LIBRARY_FACTORY, PacketRecycler,
+    SizeT, maxCachedPackets,
+    IAllocator*, allocator
+)
+
+END_NAMESPACE_OPENDAQ
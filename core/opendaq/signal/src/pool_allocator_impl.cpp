@@ -0,0 +1,147 @@
+#include <opendaq/pool_allocator_impl.h>
+#include <opendaq/signal_errors.h>
+#include <opendaq/signal_exceptions.h>
+#include <coreobjects/property_factory.h>
+#include <coretypes/common.h>
+#include <coretypes/impl.h>
+#include <new>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+PoolAllocatorImpl::PoolAllocatorImpl(SizeT alignment, SizeT maxCachedBuffers)
+    : alignment(alignment)
+    , maxCachedBuffers(maxCachedBuffers)
+    , hits(0)
+    , misses(0)
+    , bytesInUse(0)
+    , highWaterMark(0)
+{
+    // The size of each block is stored in front of the returned address
+    if (alignment < sizeof(SizeT) || (alignment & (alignment - 1)) != 0)
+        throw InvalidParameterException("Alignment must be a power of two and at least {} bytes.", sizeof(SizeT));
+
+    initProperties();
+}
+
+PoolAllocatorImpl::~PoolAllocatorImpl()
+{
+    for (const auto& [_, freeList] : freeLists)
+        for (void* address : freeList)
+            freeBlock(address);
+}
+
+ErrCode PoolAllocatorImpl::allocate(
+    const IDataDescriptor *descriptor,
+    SizeT bytes,
+    SizeT align,
+    VoidPtr* address)
+{
+    OPENDAQ_PARAM_NOT_NULL(address);
+
+    if (align > alignment)
+        return makeErrorInfo(OPENDAQ_ERR_PACKET_MEMORY_ALLOCATION, "Requested alignment exceeds the alignment of the pool");
+
+    {
+        std::scoped_lock lock(sync);
+
+        bytesInUse += bytes;
+        if (bytesInUse > highWaterMark)
+            highWaterMark = bytesInUse;
+
+        const auto it = freeLists.find(bytes);
+        if (it != freeLists.end() && !it->second.empty())
+        {
+            *address = it->second.back();
+            it->second.pop_back();
+            ++hits;
+            return OPENDAQ_SUCCESS;
+        }
+
+        ++misses;
+    }
+
+    *address = allocateBlock(bytes);
+    if (*address == nullptr)
+    {
+        std::scoped_lock lock(sync);
+        bytesInUse -= bytes;
+    }
+
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode PoolAllocatorImpl::free(VoidPtr address)
+{
+    if (!address)
+        return OPENDAQ_SUCCESS;
+
+    const SizeT bytes = getBlockSize(address);
+    {
+        std::scoped_lock lock(sync);
+
+        bytesInUse -= bytes;
+
+        auto& freeList = freeLists[bytes];
+        if (freeList.size() < maxCachedBuffers)
+        {
+            freeList.push_back(address);
+            return OPENDAQ_SUCCESS;
+        }
+    }
+
+    freeBlock(address);
+    return OPENDAQ_SUCCESS;
+}
+
+void PoolAllocatorImpl::initProperties()
+{
+    Super::addProperty(IntPropertyBuilder("Alignment", static_cast<Int>(alignment)).setReadOnly(true).build());
+    Super::addProperty(IntPropertyBuilder("MaxCachedBuffers", static_cast<Int>(maxCachedBuffers)).setReadOnly(true).build());
+
+    addStatisticProperty("Hits", hits);
+    addStatisticProperty("Misses", misses);
+    addStatisticProperty("BytesInUse", bytesInUse);
+    addStatisticProperty("HighWaterMark", highWaterMark);
+}
+
+void PoolAllocatorImpl::addStatisticProperty(const StringPtr& name, const SizeT& value)
+{
+    Super::addProperty(IntPropertyBuilder(name, 0).setReadOnly(true).build());
+
+    // Statistics change on every allocation, so they are only read out when the property is accessed
+    objPtr.getOnPropertyValueRead(name) += [this, &value](PropertyObjectPtr&, PropertyValueEventArgsPtr& args)
+    {
+        std::scoped_lock lock(sync);
+        args.setValue(static_cast<Int>(value));
+    };
+}
+
+void* PoolAllocatorImpl::allocateBlock(SizeT bytes) const
+{
+    void* block = ::operator new(alignment + bytes, std::align_val_t(alignment), std::nothrow);
+    if (block == nullptr)
+        return nullptr;
+
+    void* address = static_cast<char*>(block) + alignment;
+    getBlockSize(address) = bytes;
+    return address;
+}
+
+void PoolAllocatorImpl::freeBlock(void* address) const
+{
+    ::operator delete(static_cast<char*>(address) - alignment, std::align_val_t(alignment));
+}
+
+SizeT& PoolAllocatorImpl::getBlockSize(void* address)
+{
+    return *(static_cast<SizeT*>(address) - 1);
+}
+
+OPENDAQ_DEFINE_CLASS_FACTORY_WITH_INTERFACE(
+    LIBRARY_FACTORY, PoolAllocator,
+    IAllocator,
+    SizeT, alignment,
+    SizeT, maxCachedBuffers
+)
+
+END_NAMESPACE_OPENDAQ
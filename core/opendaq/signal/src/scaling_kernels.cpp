@@ -0,0 +1,945 @@
+#include <opendaq/scaling_kernels.h>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#if defined(__x86_64__) || defined(_M_X64)
+    #define OPENDAQ_SIMD_X86
+    #include <immintrin.h>
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>
+        #define OPENDAQ_TARGET_AVX2
+        #define OPENDAQ_TARGET_AVX512
+    #else
+        #define OPENDAQ_TARGET_AVX2 __attribute__((target("avx2")))
+        #define OPENDAQ_TARGET_AVX512 __attribute__((target("avx2,avx512f,avx512dq,avx512bw,avx512vl")))
+    #endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    #define OPENDAQ_SIMD_NEON
+    #include <arm_neon.h>
+#endif
+
+BEGIN_NAMESPACE_OPENDAQ
+
+namespace
+{
+
+// Scalar loops, used for the remainders that do not fill a whole vector and, through
+// getScalarLinearScaleKernel and getScalarLinearRuleKernel, when there is no vector kernel.
+
+template <typename T, typename U>
+inline void scaleLinearScalar(const T* input, U* output, SizeT sampleCount, U scale, U offset)
+{
+    for (SizeT i = 0; i < sampleCount; ++i)
+        output[i] = scale * static_cast<U>(input[i]) + offset;
+}
+
+template <typename T>
+inline void ruleLinearScalar(T* output, SizeT first, SizeT last, T delta, T offset)
+{
+    for (SizeT i = first; i < last; ++i)
+        output[i] = delta * static_cast<T>(i) + offset;
+}
+
+template <typename T>
+void ruleLinearScalarKernel(T* output, SizeT sampleCount, T delta, T offset)
+{
+    ruleLinearScalar(output, 0, sampleCount, delta, offset);
+}
+
+template <typename T, typename U>
+inline void convertScalar(const T* input, U* output, SizeT sampleCount)
+{
+    for (SizeT i = 0; i < sampleCount; ++i)
+        output[i] = static_cast<U>(input[i]);
+}
+
+// Integer rules are computed incrementally; unsigned arithmetic gives the same wrap-around
+// results as the scalar expression without relying on signed overflow
+template <typename T>
+inline T ruleLinearIntegerValue(SizeT index, T delta, T offset)
+{
+    using UT = std::make_unsigned_t<T>;
+    return static_cast<T>(static_cast<UT>(static_cast<UT>(index) * static_cast<UT>(delta) + static_cast<UT>(offset)));
+}
+
+template <typename T>
+inline void fillIntegerRuleBase(T* base, SizeT first, SizeT lanes, T delta, T offset)
+{
+    for (SizeT k = 0; k < lanes; ++k)
+        base[k] = ruleLinearIntegerValue<T>(first + k, delta, offset);
+}
+
+template <typename T>
+constexpr bool isSmallInteger = std::is_integral_v<T> && sizeof(T) <= 4;
+
+template <typename T>
+constexpr bool is64BitInteger = std::is_integral_v<T> && sizeof(T) == 8;
+
+template <typename T, typename U>
+constexpr bool isWideningInteger = std::is_integral_v<T> && std::is_integral_v<U> && sizeof(U) > sizeof(T);
+
+// Index vectors are kept in 32-bit lanes
+constexpr SizeT MaxVectorIndex = static_cast<SizeT>(std::numeric_limits<int32_t>::max()) - 64;
+
+#if defined(OPENDAQ_SIMD_X86)
+
+// AVX2
+
+template <typename T>
+OPENDAQ_TARGET_AVX2 inline __m256i avx2Load8AsInt32(const T* input)
+{
+    if constexpr (std::is_same_v<T, int8_t>)
+        return _mm256_cvtepi8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(input)));
+    else if constexpr (std::is_same_v<T, uint8_t>)
+        return _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(input)));
+    else if constexpr (std::is_same_v<T, int16_t>)
+        return _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input)));
+    else if constexpr (std::is_same_v<T, uint16_t>)
+        return _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input)));
+    else
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input));
+}
+
+// Exact conversion of four unsigned 32-bit values
+OPENDAQ_TARGET_AVX2 inline __m256d avx2Uint32ToDouble(__m128i values)
+{
+    const __m256d converted = _mm256_cvtepi32_pd(values);
+    const __m256d negative = _mm256_cmp_pd(converted, _mm256_setzero_pd(), _CMP_LT_OQ);
+    return _mm256_add_pd(converted, _mm256_and_pd(negative, _mm256_set1_pd(4294967296.0)));
+}
+
+template <typename T>
+OPENDAQ_TARGET_AVX2 inline void avx2Load8AsDouble(const T* input, __m256d& low, __m256d& high)
+{
+    if constexpr (std::is_same_v<T, double>)
+    {
+        low = _mm256_loadu_pd(input);
+        high = _mm256_loadu_pd(input + 4);
+    }
+    else if constexpr (std::is_same_v<T, float>)
+    {
+        const __m256 values = _mm256_loadu_ps(input);
+        low = _mm256_cvtps_pd(_mm256_castps256_ps128(values));
+        high = _mm256_cvtps_pd(_mm256_extractf128_ps(values, 1));
+    }
+    else if constexpr (std::is_same_v<T, uint32_t>)
+    {
+        const __m256i values = avx2Load8AsInt32(input);
+        low = avx2Uint32ToDouble(_mm256_castsi256_si128(values));
+        high = avx2Uint32ToDouble(_mm256_extracti128_si256(values, 1));
+    }
+    else
+    {
+        const __m256i values = avx2Load8AsInt32(input);
+        low = _mm256_cvtepi32_pd(_mm256_castsi256_si128(values));
+        high = _mm256_cvtepi32_pd(_mm256_extracti128_si256(values, 1));
+    }
+}
+
+template <typename T>
+OPENDAQ_TARGET_AVX2 inline __m256 avx2Load8AsFloat(const T* input)
+{
+    if constexpr (std::is_same_v<T, float>)
+    {
+        return _mm256_loadu_ps(input);
+    }
+    else if constexpr (std::is_same_v<T, double> || std::is_same_v<T, uint32_t>)
+    {
+        // uint32 -> double is exact, so the single double -> float rounding matches a direct conversion
+        __m256d low, high;
+        avx2Load8AsDouble(input, low, high);
+        return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm256_cvtpd_ps(low)), _mm256_cvtpd_ps(high), 1);
+    }
+    else
+    {
+        return _mm256_cvtepi32_ps(avx2Load8AsInt32(input));
+    }
+}
+
+template <typename T, typename U>
+OPENDAQ_TARGET_AVX2 void avx2ScaleLinear(const T* input, U* output, SizeT sampleCount, U scale, U offset)
+{
+    SizeT i = 0;
+    if constexpr (std::is_same_v<U, float>)
+    {
+        const __m256 scaleVec = _mm256_set1_ps(scale);
+        const __m256 offsetVec = _mm256_set1_ps(offset);
+        for (; i + 8 <= sampleCount; i += 8)
+        {
+            const __m256 values = avx2Load8AsFloat(input + i);
+            _mm256_storeu_ps(output + i, _mm256_add_ps(_mm256_mul_ps(values, scaleVec), offsetVec));
+        }
+    }
+    else
+    {
+        const __m256d scaleVec = _mm256_set1_pd(scale);
+        const __m256d offsetVec = _mm256_set1_pd(offset);
+        for (; i + 8 <= sampleCount; i += 8)
+        {
+            __m256d low, high;
+            avx2Load8AsDouble(input + i, low, high);
+            _mm256_storeu_pd(output + i, _mm256_add_pd(_mm256_mul_pd(low, scaleVec), offsetVec));
+            _mm256_storeu_pd(output + i + 4, _mm256_add_pd(_mm256_mul_pd(high, scaleVec), offsetVec));
+        }
+    }
+
+    scaleLinearScalar(input + i, output + i, sampleCount - i, scale, offset);
+}
+
+template <typename T>
+OPENDAQ_TARGET_AVX2 inline __m256i avx2AddInteger(__m256i a, __m256i b)
+{
+    if constexpr (sizeof(T) == 1)
+        return _mm256_add_epi8(a, b);
+    else if constexpr (sizeof(T) == 2)
+        return _mm256_add_epi16(a, b);
+    else if constexpr (sizeof(T) == 4)
+        return _mm256_add_epi32(a, b);
+    else
+        return _mm256_add_epi64(a, b);
+}
+
+template <typename T>
+OPENDAQ_TARGET_AVX2 void avx2RuleLinear(T* output, SizeT sampleCount, T delta, T offset)
+{
+    SizeT i = 0;
+    if constexpr (std::is_same_v<T, float>)
+    {
+        const SizeT vectorCount = sampleCount < MaxVectorIndex ? sampleCount : MaxVectorIndex;
+        const __m256 deltaVec = _mm256_set1_ps(delta);
+        const __m256 offsetVec = _mm256_set1_ps(offset);
+        const __m256i step = _mm256_set1_epi32(8);
+        __m256i index = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+        for (; i + 8 <= vectorCount; i += 8)
+        {
+            _mm256_storeu_ps(output + i, _mm256_add_ps(_mm256_mul_ps(deltaVec, _mm256_cvtepi32_ps(index)), offsetVec));
+            index = _mm256_add_epi32(index, step);
+        }
+        ruleLinearScalar(output, i, sampleCount, delta, offset);
+    }
+    else if constexpr (std::is_same_v<T, double>)
+    {
+        const SizeT vectorCount = sampleCount < MaxVectorIndex ? sampleCount : MaxVectorIndex;
+        const __m256d deltaVec = _mm256_set1_pd(delta);
+        const __m256d offsetVec = _mm256_set1_pd(offset);
+        const __m128i step = _mm_set1_epi32(4);
+        __m128i index = _mm_setr_epi32(0, 1, 2, 3);
+        for (; i + 4 <= vectorCount; i += 4)
+        {
+            _mm256_storeu_pd(output + i, _mm256_add_pd(_mm256_mul_pd(deltaVec, _mm256_cvtepi32_pd(index)), offsetVec));
+            index = _mm_add_epi32(index, step);
+        }
+        ruleLinearScalar(output, i, sampleCount, delta, offset);
+    }
+    else
+    {
+        constexpr SizeT lanes = 32 / sizeof(T);
+        alignas(32) T base[lanes];
+        alignas(32) T steps[lanes];
+        fillIntegerRuleBase(base, 0, lanes, delta, offset);
+        for (SizeT k = 0; k < lanes; ++k)
+            steps[k] = ruleLinearIntegerValue<T>(lanes, delta, T{0});
+
+        __m256i values = _mm256_load_si256(reinterpret_cast<const __m256i*>(base));
+        const __m256i step = _mm256_load_si256(reinterpret_cast<const __m256i*>(steps));
+        for (; i + lanes <= sampleCount; i += lanes)
+        {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), values);
+            values = avx2AddInteger<T>(values, step);
+        }
+
+        for (; i < sampleCount; ++i)
+            output[i] = ruleLinearIntegerValue<T>(i, delta, offset);
+    }
+}
+
+// Loads 32 / sizeof(U) integers, extending them to the width of U by the signedness of T
+template <typename T, typename U>
+OPENDAQ_TARGET_AVX2 inline __m256i avx2LoadWidened(const T* input)
+{
+    if constexpr (sizeof(U) == 2)
+    {
+        const __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input));
+        return std::is_signed_v<T> ? _mm256_cvtepi8_epi16(values) : _mm256_cvtepu8_epi16(values);
+    }
+    else if constexpr (sizeof(U) == 4)
+    {
+        return avx2Load8AsInt32(input);
+    }
+    else if constexpr (sizeof(T) == 1)
+    {
+        int32_t bytes;
+        std::memcpy(&bytes, input, sizeof(bytes));
+        const __m128i values = _mm_cvtsi32_si128(bytes);
+        return std::is_signed_v<T> ? _mm256_cvtepi8_epi64(values) : _mm256_cvtepu8_epi64(values);
+    }
+    else if constexpr (sizeof(T) == 2)
+    {
+        const __m128i values = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(input));
+        return std::is_signed_v<T> ? _mm256_cvtepi16_epi64(values) : _mm256_cvtepu16_epi64(values);
+    }
+    else
+    {
+        const __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input));
+        return std::is_signed_v<T> ? _mm256_cvtepi32_epi64(values) : _mm256_cvtepu32_epi64(values);
+    }
+}
+
+template <typename T, typename U>
+OPENDAQ_TARGET_AVX2 void avx2Convert(const T* input, U* output, SizeT sampleCount)
+{
+    SizeT i = 0;
+    if constexpr (std::is_same_v<U, float>)
+    {
+        for (; i + 8 <= sampleCount; i += 8)
+            _mm256_storeu_ps(output + i, avx2Load8AsFloat(input + i));
+    }
+    else if constexpr (std::is_same_v<U, double>)
+    {
+        for (; i + 8 <= sampleCount; i += 8)
+        {
+            __m256d low, high;
+            avx2Load8AsDouble(input + i, low, high);
+            _mm256_storeu_pd(output + i, low);
+            _mm256_storeu_pd(output + i + 4, high);
+        }
+    }
+    else
+    {
+        constexpr SizeT lanes = 32 / sizeof(U);
+        for (; i + lanes <= sampleCount; i += lanes)
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), avx2LoadWidened<T, U>(input + i));
+    }
+
+    convertScalar(input + i, output + i, sampleCount - i);
+}
+
+// AVX-512
+
+template <typename T>
+OPENDAQ_TARGET_AVX512 inline __m512 avx512Load16AsFloat(const T* input)
+{
+    if constexpr (std::is_same_v<T, float>)
+    {
+        return _mm512_loadu_ps(input);
+    }
+    else if constexpr (std::is_same_v<T, double>)
+    {
+        const __m256 low = _mm512_cvtpd_ps(_mm512_loadu_pd(input));
+        const __m256 high = _mm512_cvtpd_ps(_mm512_loadu_pd(input + 8));
+        return _mm512_insertf32x8(_mm512_castps256_ps512(low), high, 1);
+    }
+    else if constexpr (std::is_same_v<T, int64_t>)
+    {
+        const __m256 low = _mm512_cvtepi64_ps(_mm512_loadu_si512(input));
+        const __m256 high = _mm512_cvtepi64_ps(_mm512_loadu_si512(input + 8));
+        return _mm512_insertf32x8(_mm512_castps256_ps512(low), high, 1);
+    }
+    else if constexpr (std::is_same_v<T, uint64_t>)
+    {
+        const __m256 low = _mm512_cvtepu64_ps(_mm512_loadu_si512(input));
+        const __m256 high = _mm512_cvtepu64_ps(_mm512_loadu_si512(input + 8));
+        return _mm512_insertf32x8(_mm512_castps256_ps512(low), high, 1);
+    }
+    else if constexpr (std::is_same_v<T, int8_t>)
+        return _mm512_cvtepi32_ps(_mm512_cvtepi8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input))));
+    else if constexpr (std::is_same_v<T, uint8_t>)
+        return _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input))));
+    else if constexpr (std::is_same_v<T, int16_t>)
+        return _mm512_cvtepi32_ps(_mm512_cvtepi16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(input))));
+    else if constexpr (std::is_same_v<T, uint16_t>)
+        return _mm512_cvtepi32_ps(_mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(input))));
+    else if constexpr (std::is_same_v<T, int32_t>)
+        return _mm512_cvtepi32_ps(_mm512_loadu_si512(input));
+    else
+        return _mm512_cvtepu32_ps(_mm512_loadu_si512(input));
+}
+
+template <typename T>
+OPENDAQ_TARGET_AVX512 inline __m512d avx512Load8AsDouble(const T* input)
+{
+    if constexpr (std::is_same_v<T, double>)
+        return _mm512_loadu_pd(input);
+    else if constexpr (std::is_same_v<T, float>)
+        return _mm512_cvtps_pd(_mm256_loadu_ps(input));
+    else if constexpr (std::is_same_v<T, int64_t>)
+        return _mm512_cvtepi64_pd(_mm512_loadu_si512(input));
+    else if constexpr (std::is_same_v<T, uint64_t>)
+        return _mm512_cvtepu64_pd(_mm512_loadu_si512(input));
+    else if constexpr (std::is_same_v<T, uint32_t>)
+        return _mm512_cvtepu32_pd(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(input)));
+    else
+        return _mm512_cvtepi32_pd(avx2Load8AsInt32(input));
+}
+
+template <typename T, typename U>
+OPENDAQ_TARGET_AVX512 void avx512ScaleLinear(const T* input, U* output, SizeT sampleCount, U scale, U offset)
+{
+    SizeT i = 0;
+    if constexpr (std::is_same_v<U, float>)
+    {
+        const __m512 scaleVec = _mm512_set1_ps(scale);
+        const __m512 offsetVec = _mm512_set1_ps(offset);
+        for (; i + 16 <= sampleCount; i += 16)
+        {
+            const __m512 values = avx512Load16AsFloat(input + i);
+            _mm512_storeu_ps(output + i, _mm512_add_ps(_mm512_mul_ps(values, scaleVec), offsetVec));
+        }
+    }
+    else
+    {
+        const __m512d scaleVec = _mm512_set1_pd(scale);
+        const __m512d offsetVec = _mm512_set1_pd(offset);
+        for (; i + 8 <= sampleCount; i += 8)
+        {
+            const __m512d values = avx512Load8AsDouble(input + i);
+            _mm512_storeu_pd(output + i, _mm512_add_pd(_mm512_mul_pd(values, scaleVec), offsetVec));
+        }
+    }
+
+    scaleLinearScalar(input + i, output + i, sampleCount - i, scale, offset);
+}
+
+template <typename T>
+OPENDAQ_TARGET_AVX512 inline __m512i avx512AddInteger(__m512i a, __m512i b)
+{
+    if constexpr (sizeof(T) == 1)
+        return _mm512_add_epi8(a, b);
+    else if constexpr (sizeof(T) == 2)
+        return _mm512_add_epi16(a, b);
+    else if constexpr (sizeof(T) == 4)
+        return _mm512_add_epi32(a, b);
+    else
+        return _mm512_add_epi64(a, b);
+}
+
+template <typename T>
+OPENDAQ_TARGET_AVX512 void avx512RuleLinear(T* output, SizeT sampleCount, T delta, T offset)
+{
+    SizeT i = 0;
+    if constexpr (std::is_same_v<T, float>)
+    {
+        const SizeT vectorCount = sampleCount < MaxVectorIndex ? sampleCount : MaxVectorIndex;
+        const __m512 deltaVec = _mm512_set1_ps(delta);
+        const __m512 offsetVec = _mm512_set1_ps(offset);
+        const __m512i step = _mm512_set1_epi32(16);
+        __m512i index = _mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+        for (; i + 16 <= vectorCount; i += 16)
+        {
+            _mm512_storeu_ps(output + i, _mm512_add_ps(_mm512_mul_ps(deltaVec, _mm512_cvtepi32_ps(index)), offsetVec));
+            index = _mm512_add_epi32(index, step);
+        }
+        ruleLinearScalar(output, i, sampleCount, delta, offset);
+    }
+    else if constexpr (std::is_same_v<T, double>)
+    {
+        const SizeT vectorCount = sampleCount < MaxVectorIndex ? sampleCount : MaxVectorIndex;
+        const __m512d deltaVec = _mm512_set1_pd(delta);
+        const __m512d offsetVec = _mm512_set1_pd(offset);
+        const __m256i step = _mm256_set1_epi32(8);
+        __m256i index = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+        for (; i + 8 <= vectorCount; i += 8)
+        {
+            _mm512_storeu_pd(output + i, _mm512_add_pd(_mm512_mul_pd(deltaVec, _mm512_cvtepi32_pd(index)), offsetVec));
+            index = _mm256_add_epi32(index, step);
+        }
+        ruleLinearScalar(output, i, sampleCount, delta, offset);
+    }
+    else
+    {
+        constexpr SizeT lanes = 64 / sizeof(T);
+        alignas(64) T base[lanes];
+        alignas(64) T steps[lanes];
+        fillIntegerRuleBase(base, 0, lanes, delta, offset);
+        for (SizeT k = 0; k < lanes; ++k)
+            steps[k] = ruleLinearIntegerValue<T>(lanes, delta, T{0});
+
+        __m512i values = _mm512_load_si512(base);
+        const __m512i step = _mm512_load_si512(steps);
+        for (; i + lanes <= sampleCount; i += lanes)
+        {
+            _mm512_storeu_si512(output + i, values);
+            values = avx512AddInteger<T>(values, step);
+        }
+
+        for (; i < sampleCount; ++i)
+            output[i] = ruleLinearIntegerValue<T>(i, delta, offset);
+    }
+}
+
+template <typename T, typename U>
+OPENDAQ_TARGET_AVX512 void avx512Convert(const T* input, U* output, SizeT sampleCount)
+{
+    SizeT i = 0;
+    if constexpr (std::is_same_v<U, float>)
+    {
+        for (; i + 16 <= sampleCount; i += 16)
+            _mm512_storeu_ps(output + i, avx512Load16AsFloat(input + i));
+    }
+    else
+    {
+        for (; i + 8 <= sampleCount; i += 8)
+            _mm512_storeu_pd(output + i, avx512Load8AsDouble(input + i));
+    }
+
+    convertScalar(input + i, output + i, sampleCount - i);
+}
+
+#endif
+
+#if defined(OPENDAQ_SIMD_NEON)
+
+template <typename T>
+inline void neonLoad8AsInt32(const T* input, int32x4_t& low, int32x4_t& high)
+{
+    if constexpr (std::is_same_v<T, int8_t>)
+    {
+        const int16x8_t values = vmovl_s8(vld1_s8(input));
+        low = vmovl_s16(vget_low_s16(values));
+        high = vmovl_high_s16(values);
+    }
+    else if constexpr (std::is_same_v<T, int16_t>)
+    {
+        const int16x8_t values = vld1q_s16(input);
+        low = vmovl_s16(vget_low_s16(values));
+        high = vmovl_high_s16(values);
+    }
+    else
+    {
+        low = vld1q_s32(input);
+        high = vld1q_s32(input + 4);
+    }
+}
+
+template <typename T>
+inline void neonLoad8AsUint32(const T* input, uint32x4_t& low, uint32x4_t& high)
+{
+    if constexpr (std::is_same_v<T, uint8_t>)
+    {
+        const uint16x8_t values = vmovl_u8(vld1_u8(input));
+        low = vmovl_u16(vget_low_u16(values));
+        high = vmovl_high_u16(values);
+    }
+    else if constexpr (std::is_same_v<T, uint16_t>)
+    {
+        const uint16x8_t values = vld1q_u16(input);
+        low = vmovl_u16(vget_low_u16(values));
+        high = vmovl_high_u16(values);
+    }
+    else
+    {
+        low = vld1q_u32(input);
+        high = vld1q_u32(input + 4);
+    }
+}
+
+template <typename T>
+inline void neonLoad8AsFloat(const T* input, float32x4_t& low, float32x4_t& high)
+{
+    if constexpr (std::is_same_v<T, float>)
+    {
+        low = vld1q_f32(input);
+        high = vld1q_f32(input + 4);
+    }
+    else if constexpr (std::is_same_v<T, double>)
+    {
+        low = vcombine_f32(vcvt_f32_f64(vld1q_f64(input)), vcvt_f32_f64(vld1q_f64(input + 2)));
+        high = vcombine_f32(vcvt_f32_f64(vld1q_f64(input + 4)), vcvt_f32_f64(vld1q_f64(input + 6)));
+    }
+    else if constexpr (std::is_signed_v<T>)
+    {
+        int32x4_t intLow, intHigh;
+        neonLoad8AsInt32(input, intLow, intHigh);
+        low = vcvtq_f32_s32(intLow);
+        high = vcvtq_f32_s32(intHigh);
+    }
+    else
+    {
+        uint32x4_t intLow, intHigh;
+        neonLoad8AsUint32(input, intLow, intHigh);
+        low = vcvtq_f32_u32(intLow);
+        high = vcvtq_f32_u32(intHigh);
+    }
+}
+
+template <typename T>
+inline void neonLoad8AsDouble(const T* input, float64x2_t (&values)[4])
+{
+    if constexpr (std::is_same_v<T, double>)
+    {
+        for (int k = 0; k < 4; ++k)
+            values[k] = vld1q_f64(input + 2 * k);
+    }
+    else if constexpr (std::is_same_v<T, float>)
+    {
+        const float32x4_t low = vld1q_f32(input);
+        const float32x4_t high = vld1q_f32(input + 4);
+        values[0] = vcvt_f64_f32(vget_low_f32(low));
+        values[1] = vcvt_high_f64_f32(low);
+        values[2] = vcvt_f64_f32(vget_low_f32(high));
+        values[3] = vcvt_high_f64_f32(high);
+    }
+    else if constexpr (std::is_same_v<T, int64_t>)
+    {
+        for (int k = 0; k < 4; ++k)
+            values[k] = vcvtq_f64_s64(vld1q_s64(input + 2 * k));
+    }
+    else if constexpr (std::is_same_v<T, uint64_t>)
+    {
+        for (int k = 0; k < 4; ++k)
+            values[k] = vcvtq_f64_u64(vld1q_u64(input + 2 * k));
+    }
+    else if constexpr (std::is_signed_v<T>)
+    {
+        int32x4_t low, high;
+        neonLoad8AsInt32(input, low, high);
+        values[0] = vcvtq_f64_s64(vmovl_s32(vget_low_s32(low)));
+        values[1] = vcvtq_f64_s64(vmovl_high_s32(low));
+        values[2] = vcvtq_f64_s64(vmovl_s32(vget_low_s32(high)));
+        values[3] = vcvtq_f64_s64(vmovl_high_s32(high));
+    }
+    else
+    {
+        uint32x4_t low, high;
+        neonLoad8AsUint32(input, low, high);
+        values[0] = vcvtq_f64_u64(vmovl_u32(vget_low_u32(low)));
+        values[1] = vcvtq_f64_u64(vmovl_high_u32(low));
+        values[2] = vcvtq_f64_u64(vmovl_u32(vget_low_u32(high)));
+        values[3] = vcvtq_f64_u64(vmovl_high_u32(high));
+    }
+}
+
+template <typename T, typename U>
+void neonScaleLinear(const T* input, U* output, SizeT sampleCount, U scale, U offset)
+{
+    SizeT i = 0;
+    if constexpr (std::is_same_v<U, float>)
+    {
+        const float32x4_t scaleVec = vdupq_n_f32(scale);
+        const float32x4_t offsetVec = vdupq_n_f32(offset);
+        for (; i + 8 <= sampleCount; i += 8)
+        {
+            float32x4_t low, high;
+            neonLoad8AsFloat(input + i, low, high);
+            vst1q_f32(output + i, vaddq_f32(vmulq_f32(low, scaleVec), offsetVec));
+            vst1q_f32(output + i + 4, vaddq_f32(vmulq_f32(high, scaleVec), offsetVec));
+        }
+    }
+    else
+    {
+        const float64x2_t scaleVec = vdupq_n_f64(scale);
+        const float64x2_t offsetVec = vdupq_n_f64(offset);
+        for (; i + 8 <= sampleCount; i += 8)
+        {
+            float64x2_t values[4];
+            neonLoad8AsDouble(input + i, values);
+            for (int k = 0; k < 4; ++k)
+                vst1q_f64(output + i + 2 * k, vaddq_f64(vmulq_f64(values[k], scaleVec), offsetVec));
+        }
+    }
+
+    scaleLinearScalar(input + i, output + i, sampleCount - i, scale, offset);
+}
+
+template <typename T>
+void neonRuleLinear(T* output, SizeT sampleCount, T delta, T offset)
+{
+    SizeT i = 0;
+    if constexpr (std::is_same_v<T, float>)
+    {
+        const SizeT vectorCount = sampleCount < MaxVectorIndex ? sampleCount : MaxVectorIndex;
+        const float32x4_t deltaVec = vdupq_n_f32(delta);
+        const float32x4_t offsetVec = vdupq_n_f32(offset);
+        const uint32_t indexInit[4] = {0, 1, 2, 3};
+        uint32x4_t index = vld1q_u32(indexInit);
+        const uint32x4_t step = vdupq_n_u32(4);
+        for (; i + 4 <= vectorCount; i += 4)
+        {
+            vst1q_f32(output + i, vaddq_f32(vmulq_f32(deltaVec, vcvtq_f32_u32(index)), offsetVec));
+            index = vaddq_u32(index, step);
+        }
+        ruleLinearScalar(output, i, sampleCount, delta, offset);
+    }
+    else if constexpr (std::is_same_v<T, double>)
+    {
+        const float64x2_t deltaVec = vdupq_n_f64(delta);
+        const float64x2_t offsetVec = vdupq_n_f64(offset);
+        const uint64_t indexInit[2] = {0, 1};
+        uint64x2_t index = vld1q_u64(indexInit);
+        const uint64x2_t step = vdupq_n_u64(2);
+        for (; i + 2 <= sampleCount; i += 2)
+        {
+            vst1q_f64(output + i, vaddq_f64(vmulq_f64(deltaVec, vcvtq_f64_u64(index)), offsetVec));
+            index = vaddq_u64(index, step);
+        }
+        ruleLinearScalar(output, i, sampleCount, delta, offset);
+    }
+    else
+    {
+        constexpr SizeT lanes = 16 / sizeof(T);
+        T base[lanes];
+        T steps[lanes];
+        fillIntegerRuleBase(base, 0, lanes, delta, offset);
+        for (SizeT k = 0; k < lanes; ++k)
+            steps[k] = ruleLinearIntegerValue<T>(lanes, delta, T{0});
+
+        uint8x16_t values = vld1q_u8(reinterpret_cast<const uint8_t*>(base));
+        const uint8x16_t step = vld1q_u8(reinterpret_cast<const uint8_t*>(steps));
+        for (; i + lanes <= sampleCount; i += lanes)
+        {
+            vst1q_u8(reinterpret_cast<uint8_t*>(output + i), values);
+            if constexpr (sizeof(T) == 1)
+                values = vaddq_u8(values, step);
+            else if constexpr (sizeof(T) == 2)
+                values = vreinterpretq_u8_u16(vaddq_u16(vreinterpretq_u16_u8(values), vreinterpretq_u16_u8(step)));
+            else if constexpr (sizeof(T) == 4)
+                values = vreinterpretq_u8_u32(vaddq_u32(vreinterpretq_u32_u8(values), vreinterpretq_u32_u8(step)));
+            else
+                values = vreinterpretq_u8_u64(vaddq_u64(vreinterpretq_u64_u8(values), vreinterpretq_u64_u8(step)));
+        }
+
+        for (; i < sampleCount; ++i)
+            output[i] = ruleLinearIntegerValue<T>(i, delta, offset);
+    }
+}
+
+template <typename T, typename U>
+void neonConvert(const T* input, U* output, SizeT sampleCount)
+{
+    SizeT i = 0;
+    if constexpr (std::is_same_v<U, float>)
+    {
+        for (; i + 8 <= sampleCount; i += 8)
+        {
+            float32x4_t low, high;
+            neonLoad8AsFloat(input + i, low, high);
+            vst1q_f32(output + i, low);
+            vst1q_f32(output + i + 4, high);
+        }
+    }
+    else
+    {
+        for (; i + 8 <= sampleCount; i += 8)
+        {
+            float64x2_t values[4];
+            neonLoad8AsDouble(input + i, values);
+            for (int k = 0; k < 4; ++k)
+                vst1q_f64(output + i + 2 * k, values[k]);
+        }
+    }
+
+    convertScalar(input + i, output + i, sampleCount - i);
+}
+
+#endif
+
+SimdLevel detectSimdLevel()
+{
+#if defined(OPENDAQ_SIMD_X86)
+    #if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7)
+        return SimdLevel::Scalar;
+
+    __cpuid(info, 1);
+    const bool osxsave = (info[2] & (1 << 27)) != 0;
+    const bool avx = (info[2] & (1 << 28)) != 0;
+    if (!osxsave || !avx)
+        return SimdLevel::Scalar;
+
+    const unsigned long long xcr0 = _xgetbv(0);
+    if ((xcr0 & 0x6) != 0x6)
+        return SimdLevel::Scalar;
+
+    __cpuidex(info, 7, 0);
+    const bool avx2 = (info[1] & (1 << 5)) != 0;
+    const bool avx512 = (info[1] & (1 << 16)) != 0 &&   // F
+                        (info[1] & (1 << 17)) != 0 &&   // DQ
+                        (info[1] & (1 << 30)) != 0 &&   // BW
+                        (info[1] & (1u << 31)) != 0;    // VL
+    if (avx512 && (xcr0 & 0xE6) == 0xE6)
+        return SimdLevel::Avx512;
+    if (avx2)
+        return SimdLevel::Avx2;
+    return SimdLevel::Scalar;
+    #else
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq") && __builtin_cpu_supports("avx512bw") &&
+        __builtin_cpu_supports("avx512vl"))
+        return SimdLevel::Avx512;
+    if (__builtin_cpu_supports("avx2"))
+        return SimdLevel::Avx2;
+    return SimdLevel::Scalar;
+    #endif
+#elif defined(OPENDAQ_SIMD_NEON)
+    return SimdLevel::Neon;
+#else
+    return SimdLevel::Scalar;
+#endif
+}
+
+}
+
+SimdLevel getSimdLevel()
+{
+    static const SimdLevel level = detectSimdLevel();
+    return level;
+}
+
+template <typename T, typename U>
+LinearScaleKernel<T, U> getLinearScaleKernel(SimdLevel level)
+{
+    static_assert(std::is_same_v<U, float> || std::is_same_v<U, double>, "Scaling output must be a floating-point type");
+
+    switch (level)
+    {
+#if defined(OPENDAQ_SIMD_X86)
+        case SimdLevel::Avx512:
+            return &avx512ScaleLinear<T, U>;
+        case SimdLevel::Avx2:
+            // AVX2 has no 64-bit integer to floating-point conversions
+            if constexpr (is64BitInteger<T>)
+                return nullptr;
+            else
+                return &avx2ScaleLinear<T, U>;
+#endif
+#if defined(OPENDAQ_SIMD_NEON)
+        case SimdLevel::Neon:
+            // Converting 64-bit integers to float through double would round twice
+            if constexpr (is64BitInteger<T> && std::is_same_v<U, float>)
+                return nullptr;
+            else
+                return &neonScaleLinear<T, U>;
+#endif
+        default:
+            return nullptr;
+    }
+}
+
+template <typename T>
+LinearRuleKernel<T> getLinearRuleKernel(SimdLevel level)
+{
+    static_assert(std::is_arithmetic_v<T>, "Data rule kernels support only arithmetic types");
+
+    switch (level)
+    {
+#if defined(OPENDAQ_SIMD_X86)
+        case SimdLevel::Avx512:
+            return &avx512RuleLinear<T>;
+        case SimdLevel::Avx2:
+            return &avx2RuleLinear<T>;
+#endif
+#if defined(OPENDAQ_SIMD_NEON)
+        case SimdLevel::Neon:
+            return &neonRuleLinear<T>;
+#endif
+        default:
+            return nullptr;
+    }
+}
+
+template <typename T, typename U>
+LinearScaleKernel<T, U> getScalarLinearScaleKernel()
+{
+    static_assert(std::is_same_v<U, float> || std::is_same_v<U, double>, "Scaling output must be a floating-point type");
+    return &scaleLinearScalar<T, U>;
+}
+
+template <typename T>
+LinearRuleKernel<T> getScalarLinearRuleKernel()
+{
+    static_assert(std::is_arithmetic_v<T>, "Data rule kernels support only arithmetic types");
+    return &ruleLinearScalarKernel<T>;
+}
+
+template <typename T, typename U>
+ConvertKernel<T, U> getConvertKernel(SimdLevel level)
+{
+    static_assert(std::is_arithmetic_v<T> && std::is_arithmetic_v<U>, "Conversion kernels support only arithmetic types");
+
+    // Same-type reads are plain copies
+    if constexpr (std::is_same_v<T, U>)
+    {
+        return nullptr;
+    }
+    else if constexpr (std::is_floating_point_v<U>)
+    {
+        switch (level)
+        {
+#if defined(OPENDAQ_SIMD_X86)
+            case SimdLevel::Avx512:
+                return &avx512Convert<T, U>;
+            case SimdLevel::Avx2:
+                if constexpr (is64BitInteger<T>)
+                    return nullptr;
+                else
+                    return &avx2Convert<T, U>;
+#endif
+#if defined(OPENDAQ_SIMD_NEON)
+            case SimdLevel::Neon:
+                if constexpr (is64BitInteger<T> && std::is_same_v<U, float>)
+                    return nullptr;
+                else
+                    return &neonConvert<T, U>;
+#endif
+            default:
+                return nullptr;
+        }
+    }
+    else if constexpr (isWideningInteger<T, U>)
+    {
+        // AArch64 compilers vectorize integer widening loops on their own; on x86 the baseline is only SSE2
+        switch (level)
+        {
+#if defined(OPENDAQ_SIMD_X86)
+            case SimdLevel::Avx512:
+            case SimdLevel::Avx2:
+                return &avx2Convert<T, U>;
+#endif
+            default:
+                return nullptr;
+        }
+    }
+    else
+    {
+        // Narrowing and floating-point to integer conversions are left to the scalar loop
+        return nullptr;
+    }
+}
+
+#define OPENDAQ_INSTANTIATE_CONVERT_KERNELS(T)                                          \
+    template ConvertKernel<T, float> getConvertKernel<T, float>(SimdLevel);             \
+    template ConvertKernel<T, double> getConvertKernel<T, double>(SimdLevel);           \
+    template ConvertKernel<T, uint8_t> getConvertKernel<T, uint8_t>(SimdLevel);         \
+    template ConvertKernel<T, int8_t> getConvertKernel<T, int8_t>(SimdLevel);           \
+    template ConvertKernel<T, uint16_t> getConvertKernel<T, uint16_t>(SimdLevel);       \
+    template ConvertKernel<T, int16_t> getConvertKernel<T, int16_t>(SimdLevel);         \
+    template ConvertKernel<T, uint32_t> getConvertKernel<T, uint32_t>(SimdLevel);       \
+    template ConvertKernel<T, int32_t> getConvertKernel<T, int32_t>(SimdLevel);         \
+    template ConvertKernel<T, uint64_t> getConvertKernel<T, uint64_t>(SimdLevel);       \
+    template ConvertKernel<T, int64_t> getConvertKernel<T, int64_t>(SimdLevel);
+
+#define OPENDAQ_INSTANTIATE_SCALING_KERNELS(T)                                        \
+    template LinearScaleKernel<T, float> getLinearScaleKernel<T, float>(SimdLevel);   \
+    template LinearScaleKernel<T, double> getLinearScaleKernel<T, double>(SimdLevel); \
+    template LinearScaleKernel<T, float> getScalarLinearScaleKernel<T, float>();      \
+    template LinearScaleKernel<T, double> getScalarLinearScaleKernel<T, double>();    \
+    template LinearRuleKernel<T> getLinearRuleKernel<T>(SimdLevel);                   \
+    template LinearRuleKernel<T> getScalarLinearRuleKernel<T>();                      \
+    OPENDAQ_INSTANTIATE_CONVERT_KERNELS(T)
+
+OPENDAQ_INSTANTIATE_SCALING_KERNELS(float)
+OPENDAQ_INSTANTIATE_SCALING_KERNELS(double)
+OPENDAQ_INSTANTIATE_SCALING_KERNELS(uint8_t)
+OPENDAQ_INSTANTIATE_SCALING_KERNELS(int8_t)
+OPENDAQ_INSTANTIATE_SCALING_KERNELS(uint16_t)
+OPENDAQ_INSTANTIATE_SCALING_KERNELS(int16_t)
+OPENDAQ_INSTANTIATE_SCALING_KERNELS(uint32_t)
+OPENDAQ_INSTANTIATE_SCALING_KERNELS(int32_t)
+OPENDAQ_INSTANTIATE_SCALING_KERNELS(uint64_t)
+OPENDAQ_INSTANTIATE_SCALING_KERNELS(int64_t)
+
+END_NAMESPACE_OPENDAQ
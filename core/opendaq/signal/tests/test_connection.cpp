@@ -1,6 +1,11 @@
 #include <array>
+#include <vector>
 #include <opendaq/connection_factory.h>
+#include <opendaq/connection_utils.h>
+#include <opendaq/data_descriptor_factory.h>
+#include <opendaq/packet_factory.h>
 #include <coretypes/objectptr.h>
+#include <coretypes/list_factory.h>
 #include <gtest/gtest.h>
 #include "opendaq/gmock/context.h"
 #include "opendaq/gmock/input_port.h"
@@ -66,3 +71,158 @@ TEST_F(ConnectionTest, PeekEmpty)
 {
     ASSERT_FALSE(connection.peek().assigned());
 }
+
+TEST_F(ConnectionTest, AvailableSamples)
+{
+    const auto descriptor = DataDescriptorBuilder().setSampleType(SampleType::Float64).build();
+
+    EXPECT_CALL(inputPort.mock(), notifyPacketEnqueued).Times(5);
+    connection.enqueue(DataPacket(descriptor, 10));
+    connection.enqueue(DataPacket(descriptor, 20));
+    connection.enqueue(DataDescriptorChangedEventPacket(descriptor, nullptr));
+    connection.enqueue(DataPacket(descriptor, 30));
+    connection.enqueue(DataDescriptorChangedEventPacket(descriptor, nullptr));
+
+    ASSERT_EQ(connection.getAvailableSamples(), 60u);
+    ASSERT_EQ(connection.getSamplesUntilNextDescriptor(), 30u);
+
+    connection.dequeue();
+    ASSERT_EQ(connection.getAvailableSamples(), 50u);
+    ASSERT_EQ(connection.getSamplesUntilNextDescriptor(), 20u);
+
+    connection.dequeue();
+    ASSERT_EQ(connection.getSamplesUntilNextDescriptor(), 0u);
+
+    connection.dequeue();
+    ASSERT_EQ(connection.getAvailableSamples(), 30u);
+    ASSERT_EQ(connection.getSamplesUntilNextDescriptor(), 30u);
+
+    connection.dequeue();
+    connection.dequeue();
+    ASSERT_EQ(connection.getAvailableSamples(), 0u);
+    ASSERT_EQ(connection.getSamplesUntilNextDescriptor(), 0u);
+}
+
+TEST_F(ConnectionTest, EnqueueBeyondRingCapacity)
+{
+    const auto descriptor = DataDescriptorBuilder().setSampleType(SampleType::Float64).build();
+    constexpr SizeT packetCount = 1000;
+
+    std::vector<PacketPtr> packets;
+    EXPECT_CALL(inputPort.mock(), notifyPacketEnqueued).Times(packetCount);
+    for (SizeT i = 0; i < packetCount; ++i)
+    {
+        packets.push_back(DataPacket(descriptor, 1));
+        connection.enqueue(packets.back());
+    }
+
+    ASSERT_EQ(connection.getPacketCount(), packetCount);
+    ASSERT_EQ(connection.getAvailableSamples(), packetCount);
+
+    for (const auto& packet : packets)
+        ASSERT_EQ(connection.dequeue(), packet);
+
+    ASSERT_EQ(connection.getPacketCount(), 0u);
+    ASSERT_EQ(connection.getAvailableSamples(), 0u);
+}
+
+TEST_F(ConnectionTest, DequeueAll)
+{
+    const auto descriptor = DataDescriptorBuilder().setSampleType(SampleType::Float64).build();
+    constexpr SizeT packetCount = 100;
+
+    std::vector<PacketPtr> packets;
+    EXPECT_CALL(inputPort.mock(), notifyPacketEnqueued).Times(packetCount);
+    for (SizeT i = 0; i < packetCount; ++i)
+    {
+        packets.push_back(DataPacket(descriptor, 2));
+        connection.enqueue(packets.back());
+    }
+
+    const auto dequeued = connection.dequeueAll();
+    ASSERT_EQ(dequeued.getCount(), packetCount);
+    for (SizeT i = 0; i < packetCount; ++i)
+        ASSERT_EQ(dequeued[i], packets[i]);
+
+    ASSERT_EQ(connection.getPacketCount(), 0u);
+    ASSERT_EQ(connection.getAvailableSamples(), 0u);
+    ASSERT_EQ(connection.dequeueAll().getCount(), 0u);
+}
+
+TEST_F(ConnectionTest, DequeueUpTo)
+{
+    const auto descriptor = DataDescriptorBuilder().setSampleType(SampleType::Float64).build();
+
+    EXPECT_CALL(inputPort.mock(), notifyPacketEnqueued).Times(4);
+    const auto first = DataPacket(descriptor, 10);
+    connection.enqueue(first);
+    connection.enqueue(DataDescriptorChangedEventPacket(descriptor, nullptr));
+    connection.enqueue(DataPacket(descriptor, 20));
+    connection.enqueue(DataDescriptorChangedEventPacket(descriptor, nullptr));
+
+    ASSERT_EQ(connection.getSamplesUntilNextDescriptor(), 10u);
+
+    const auto dequeued = connection.dequeueUpTo(2);
+    ASSERT_EQ(dequeued.getCount(), 2u);
+    ASSERT_EQ(dequeued[0], first);
+    ASSERT_EQ(connection.getPacketCount(), 2u);
+    ASSERT_EQ(connection.getAvailableSamples(), 20u);
+    ASSERT_EQ(connection.getSamplesUntilNextDescriptor(), 20u);
+
+    ASSERT_EQ(connection.dequeueUpTo(10).getCount(), 2u);
+    ASSERT_EQ(connection.getAvailableSamples(), 0u);
+    ASSERT_EQ(connection.getSamplesUntilNextDescriptor(), 0u);
+}
+
+TEST_F(ConnectionTest, EnqueueMultiple)
+{
+    const auto descriptor = DataDescriptorBuilder().setSampleType(SampleType::Float64).build();
+
+    EXPECT_CALL(inputPort.mock(), notifyPacketEnqueued).Times(1);
+    const auto first = DataPacket(descriptor, 10);
+    connection.enqueueMultiple(List<IPacket>(first,
+                                             DataPacket(descriptor, 20),
+                                             DataDescriptorChangedEventPacket(descriptor, nullptr),
+                                             DataPacket(descriptor, 30),
+                                             DataDescriptorChangedEventPacket(descriptor, nullptr)));
+
+    ASSERT_EQ(connection.getPacketCount(), 5u);
+    ASSERT_EQ(connection.getAvailableSamples(), 60u);
+    ASSERT_EQ(connection.getSamplesUntilNextDescriptor(), 30u);
+    ASSERT_EQ(connection.peek(), first);
+
+    connection.dequeueUpTo(3);
+    ASSERT_EQ(connection.getAvailableSamples(), 30u);
+    ASSERT_EQ(connection.getSamplesUntilNextDescriptor(), 30u);
+
+    connection.dequeueAll();
+    ASSERT_EQ(connection.getAvailableSamples(), 0u);
+    ASSERT_EQ(connection.getSamplesUntilNextDescriptor(), 0u);
+}
+
+TEST_F(ConnectionTest, ProcessQueuedPacketsKeepsBatchOnError)
+{
+    const auto descriptor = DataDescriptorBuilder().setSampleType(SampleType::Float64).build();
+
+    EXPECT_CALL(inputPort.mock(), notifyPacketEnqueued).Times(3);
+    const auto first = DataPacket(descriptor, 1);
+    const auto second = DataPacket(descriptor, 2);
+    const auto third = DataPacket(descriptor, 3);
+    connection.enqueue(first);
+    connection.enqueue(second);
+    connection.enqueue(third);
+
+    std::vector<PacketPtr> processed;
+    ASSERT_THROW(processQueuedPackets(connection,
+                                      [&processed, &second](const PacketPtr& packet)
+                                      {
+                                          processed.push_back(packet);
+                                          if (packet == second)
+                                              throw InvalidStateException();
+                                      }),
+                 InvalidStateException);
+
+    ASSERT_EQ(processed.size(), 3u);
+    ASSERT_EQ(processed[2], third);
+    ASSERT_EQ(connection.getPacketCount(), 0u);
+}
@@ -295,6 +295,42 @@ TEST_F(DataPacketTest, TestConstantRule)
     validateImplicitConstantDataRulePacket<double>(descriptor, 678.2);
 }
 
+TEST_F(DataPacketTest, ScaledDataBufferReused)
+{
+    const auto descriptor = setupDescriptor(SampleType::Float64, ExplicitDataRule(), LinearScaling(2, 1, SampleType::Int32, ScaledSampleType::Float64));
+
+    void* firstBuffer;
+    {
+        const auto packet = createExplicitPacket<int32_t, 100>(descriptor);
+        firstBuffer = packet.getData();
+    }
+
+    const auto packet = createExplicitPacket<int32_t, 100>(descriptor);
+    ASSERT_EQ(packet.getData(), firstBuffer);
+
+    const auto scaledData = static_cast<double*>(packet.getData());
+    for (int i = 0; i < 100; ++i)
+        ASSERT_EQ(scaledData[i], 2.0 * i + 1.0);
+}
+
+TEST_F(DataPacketTest, CalculatedDataBufferReused)
+{
+    const auto descriptor = setupDescriptor(SampleType::Int64, LinearDataRule(10, 5), nullptr);
+
+    void* firstBuffer;
+    {
+        const DataPacketPtr packet = DataPacket(descriptor, 100, 1000);
+        firstBuffer = packet.getData();
+    }
+
+    const DataPacketPtr packet = DataPacket(descriptor, 100, 2000);
+    ASSERT_EQ(packet.getData(), firstBuffer);
+
+    const auto calculatedData = static_cast<int64_t*>(packet.getData());
+    for (int64_t i = 0; i < 100; ++i)
+        ASSERT_EQ(calculatedData[i], 2000 + 10 * i + 5);
+}
+
 TEST_F(DataPacketTest, TestRangeType)
 {
     RangeType<uint64_t> t1(10, 20);
@@ -1,5 +1,7 @@
 #include <array>
+#include <atomic>
 #include <chrono>
+#include <future>
 #include <thread>
 #include <gtest/gtest.h>
 #include <opendaq/context_factory.h>
@@ -106,3 +108,52 @@ TEST_F(TestPacketE2E, Basic)
 
     scheduler.stop();
 }
+
+TEST_F(TestPacketE2E, SchedulerNotificationsCoalesced)
+{
+    auto scheduler = Scheduler(Logger(), 1);
+    auto context = MockContext::Strict();
+    context.mock().scheduler = scheduler;
+    context.mock().logger = Logger();
+
+    auto listener = MockInputPortNotifications::Strict();
+    auto inputPort = InputPort(context, nullptr, "Port");
+    inputPort.setListener(listener);
+    inputPort.setNotificationMethod(PacketReadyNotification::Scheduler);
+
+    std::atomic<int> notificationCount{0};
+    std::promise<void> firstNotificationStarted;
+    std::promise<void> releaseFirstNotification;
+    auto releaseFuture = releaseFirstNotification.get_future().share();
+
+    EXPECT_CALL(listener.mock(), packetReceived(inputPort.getObject()))
+        .WillRepeatedly(Invoke(
+            [&](IInputPort*)
+            {
+                if (notificationCount++ == 0)
+                {
+                    firstNotificationStarted.set_value();
+                    releaseFuture.wait();
+                }
+                return OPENDAQ_SUCCESS;
+            }));
+
+    inputPort.notifyPacketEnqueued();
+    firstNotificationStarted.get_future().wait();
+
+    // Packets enqueued while the listener runs are handled by a single additional pass
+    for (int i = 0; i < 100; ++i)
+        inputPort.notifyPacketEnqueued();
+
+    releaseFirstNotification.set_value();
+    scheduler.waitAll();
+
+    ASSERT_EQ(notificationCount, 2);
+
+    inputPort.notifyPacketEnqueued();
+    scheduler.waitAll();
+
+    ASSERT_EQ(notificationCount, 3);
+
+    scheduler.stop();
+}
@@ -0,0 +1,174 @@
+#include <opendaq/packet_recycler_factory.h>
+#include <opendaq/packet_factory.h>
+#include <opendaq/packet_destruct_callback_factory.h>
+#include <opendaq/data_descriptor_factory.h>
+#include <opendaq/scaling_factory.h>
+#include <opendaq/data_rule_factory.h>
+#include <opendaq/pool_allocator_factory.h>
+#include <gtest/gtest.h>
+#include <vector>
+
+using PacketRecyclerTest = testing::Test;
+
+BEGIN_NAMESPACE_OPENDAQ
+
+static DataDescriptorPtr createDescriptor(SampleType sampleType = SampleType::Float64)
+{
+    return DataDescriptorBuilder().setSampleType(sampleType).build();
+}
+
+TEST_F(PacketRecyclerTest, TestFactory)
+{
+    PacketRecyclerPtr recycler;
+    ASSERT_NO_THROW(recycler = PacketRecycler());
+    ASSERT_EQ(recycler.getCachedPacketCount(), 0u);
+
+    DataPacketPtr packet;
+    ASSERT_NO_THROW(packet = RecycledDataPacket(recycler, createDescriptor(), 100));
+    ASSERT_EQ(packet.getSampleCount(), 100u);
+    ASSERT_EQ(packet.getRawDataSize(), 100u * sizeof(double));
+    ASSERT_NE(packet.getRawData(), nullptr);
+}
+
+TEST_F(PacketRecyclerTest, NullDescriptor)
+{
+    const auto recycler = PacketRecycler();
+    ASSERT_THROW(RecycledDataPacket(recycler, nullptr, 100), ArgumentNullException);
+}
+
+TEST_F(PacketRecyclerTest, ReusesReleasedPacket)
+{
+    const auto recycler = PacketRecycler();
+    const auto descriptor = createDescriptor();
+
+    auto packet = RecycledDataPacket(recycler, descriptor, 100);
+    IDataPacket* first = packet;
+    void* firstData = packet.getRawData();
+    const auto firstId = packet.getPacketId();
+
+    packet.release();
+    ASSERT_EQ(recycler.getCachedPacketCount(), 1u);
+
+    packet = RecycledDataPacket(recycler, descriptor, 100);
+    ASSERT_EQ(recycler.getCachedPacketCount(), 0u);
+    ASSERT_EQ(static_cast<IDataPacket*>(packet), first);
+    ASSERT_EQ(packet.getRawData(), firstData);
+    ASSERT_NE(packet.getPacketId(), firstId);
+    ASSERT_EQ(packet.getRefCount(), 1u);
+}
+
+TEST_F(PacketRecyclerTest, ReallocatesBufferOnSizeChange)
+{
+    const auto recycler = PacketRecycler();
+
+    auto packet = RecycledDataPacket(recycler, createDescriptor(), 100);
+    packet.release();
+
+    packet = RecycledDataPacket(recycler, createDescriptor(SampleType::Int32), 300);
+    ASSERT_EQ(packet.getSampleCount(), 300u);
+    ASSERT_EQ(packet.getRawDataSize(), 300u * sizeof(int32_t));
+    ASSERT_EQ(packet.getDataDescriptor().getSampleType(), SampleType::Int32);
+
+    auto data = static_cast<int32_t*>(packet.getRawData());
+    for (int i = 0; i < 300; ++i)
+        data[i] = i;
+    ASSERT_EQ(packet.getLastValue().asPtr<IInteger>(), 299);
+}
+
+TEST_F(PacketRecyclerTest, ReleasesReferencesOnRecycle)
+{
+    const auto recycler = PacketRecycler();
+    auto domainPacket = DataPacket(createDescriptor(SampleType::Int64), 10);
+
+    auto packet = RecycledDataPacketWithDomain(recycler, domainPacket, createDescriptor(), 10, 5);
+    ASSERT_EQ(packet.getDomainPacket(), domainPacket);
+    ASSERT_EQ(packet.getOffset(), 5);
+    ASSERT_EQ(domainPacket.getRefCount(), 2u);
+
+    packet.release();
+    ASSERT_EQ(domainPacket.getRefCount(), 1u);
+
+    packet = RecycledDataPacket(recycler, createDescriptor(), 10);
+    ASSERT_FALSE(packet.getDomainPacket().assigned());
+    ASSERT_FALSE(packet.getOffset().assigned());
+}
+
+TEST_F(PacketRecyclerTest, DestructCallbackOnRecycle)
+{
+    const auto recycler = PacketRecycler();
+
+    int destroyed = 0;
+    auto packet = RecycledDataPacket(recycler, createDescriptor(), 10);
+    packet.subscribeForDestructNotification(PacketDestructCallback([&destroyed] { destroyed++; }));
+
+    packet.release();
+    ASSERT_EQ(destroyed, 1);
+
+    packet = RecycledDataPacket(recycler, createDescriptor(), 10);
+    packet.release();
+    ASSERT_EQ(destroyed, 1);
+}
+
+TEST_F(PacketRecyclerTest, ScaledData)
+{
+    const auto recycler = PacketRecycler();
+    const auto descriptor = DataDescriptorBuilder()
+                                .setSampleType(SampleType::Float64)
+                                .setPostScaling(LinearScaling(2, 1, SampleType::Int32, ScaledSampleType::Float64))
+                                .build();
+
+    for (int round = 0; round < 2; ++round)
+    {
+        auto packet = RecycledDataPacket(recycler, descriptor, 4);
+        auto rawData = static_cast<int32_t*>(packet.getRawData());
+        for (int i = 0; i < 4; ++i)
+            rawData[i] = i + round;
+
+        auto data = static_cast<double*>(packet.getData());
+        for (int i = 0; i < 4; ++i)
+            ASSERT_DOUBLE_EQ(data[i], (i + round) * 2.0 + 1.0);
+    }
+}
+
+TEST_F(PacketRecyclerTest, MaxCachedPackets)
+{
+    const auto recycler = PacketRecycler(2);
+    const auto descriptor = createDescriptor();
+
+    std::vector<DataPacketPtr> packets;
+    for (int i = 0; i < 4; ++i)
+        packets.push_back(RecycledDataPacket(recycler, descriptor, 10));
+
+    packets.clear();
+    ASSERT_EQ(recycler.getCachedPacketCount(), 2u);
+
+    recycler.clear();
+    ASSERT_EQ(recycler.getCachedPacketCount(), 0u);
+}
+
+TEST_F(PacketRecyclerTest, PacketsOutliveRecycler)
+{
+    auto recycler = PacketRecycler();
+    auto packet = RecycledDataPacket(recycler, createDescriptor(), 10);
+
+    recycler.release();
+    ASSERT_EQ(packet.getSampleCount(), 10u);
+    ASSERT_NO_THROW(packet.release());
+}
+
+TEST_F(PacketRecyclerTest, Allocator)
+{
+    const auto allocator = PoolAllocator();
+    const auto recycler = PacketRecycler(16, allocator);
+
+    auto packet = RecycledDataPacket(recycler, createDescriptor(), 10);
+    void* data = packet.getRawData();
+    packet.release();
+
+    recycler.clear();
+    void* buffer = allocator.allocate(nullptr, 10 * sizeof(double), 8);
+    ASSERT_EQ(buffer, data);
+    allocator.free(buffer);
+}
+
+END_NAMESPACE_OPENDAQ
@@ -0,0 +1,130 @@
+#include <opendaq/pool_allocator_factory.h>
+#include <opendaq/packet_factory.h>
+#include <opendaq/data_descriptor_factory.h>
+#include <opendaq/signal_exceptions.h>
+#include <coreobjects/property_object_ptr.h>
+#include <gtest/gtest.h>
+#include <cstdint>
+
+using PoolAllocatorTest = testing::Test;
+
+BEGIN_NAMESPACE_OPENDAQ
+
+TEST_F(PoolAllocatorTest, TestFactory)
+{
+    AllocatorPtr allocator;
+    void* ptr = nullptr;
+
+    ASSERT_NO_THROW(allocator = PoolAllocator());
+
+    ASSERT_NO_THROW(ptr = allocator.allocate(nullptr, 32, 8));
+    ASSERT_NO_THROW(allocator.free(ptr));
+    ASSERT_NO_THROW(ptr = allocator.allocate(nullptr, 32, 0));
+    ASSERT_NO_THROW(allocator.free(ptr));
+    ASSERT_NO_THROW(allocator.free(nullptr));
+}
+
+TEST_F(PoolAllocatorTest, TestFactoryErrors)
+{
+    ASSERT_THROW(PoolAllocator(0), InvalidParameterException);
+    ASSERT_THROW(PoolAllocator(4), InvalidParameterException);
+    ASSERT_THROW(PoolAllocator(100), InvalidParameterException);
+}
+
+TEST_F(PoolAllocatorTest, Alignment)
+{
+    for (SizeT alignment : {SizeT(64), SizeT(4096)})
+    {
+        auto allocator = PoolAllocator(alignment);
+        for (SizeT bytes : {SizeT(1), SizeT(100), SizeT(10000)})
+        {
+            void* ptr = allocator.allocate(nullptr, bytes, 8);
+            ASSERT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % alignment, 0u);
+            allocator.free(ptr);
+        }
+    }
+
+    ASSERT_ANY_THROW(PoolAllocator(64).allocate(nullptr, 32, 128));
+}
+
+TEST_F(PoolAllocatorTest, ReusesBuffersOfSameSize)
+{
+    auto allocator = PoolAllocator();
+
+    void* first = allocator.allocate(nullptr, 1024, 8);
+    allocator.free(first);
+
+    void* second = allocator.allocate(nullptr, 1024, 8);
+    ASSERT_EQ(first, second);
+
+    void* third = allocator.allocate(nullptr, 2048, 8);
+    ASSERT_NE(third, first);
+
+    allocator.free(second);
+    allocator.free(third);
+}
+
+TEST_F(PoolAllocatorTest, MaxCachedBuffers)
+{
+    auto allocator = PoolAllocator(64, 1);
+    const auto stats = allocator.asPtr<IPropertyObject>();
+
+    void* first = allocator.allocate(nullptr, 256, 8);
+    void* second = allocator.allocate(nullptr, 256, 8);
+    allocator.free(first);
+    allocator.free(second);
+
+    allocator.allocate(nullptr, 256, 8);
+    allocator.allocate(nullptr, 256, 8);
+
+    ASSERT_EQ(stats.getPropertyValue("Hits"), 1);
+    ASSERT_EQ(stats.getPropertyValue("Misses"), 3);
+}
+
+TEST_F(PoolAllocatorTest, Statistics)
+{
+    auto allocator = PoolAllocator();
+    const auto stats = allocator.asPtr<IPropertyObject>();
+
+    ASSERT_EQ(stats.getPropertyValue("Alignment"), 64);
+    ASSERT_EQ(stats.getPropertyValue("MaxCachedBuffers"), 16);
+    ASSERT_EQ(stats.getPropertyValue("Hits"), 0);
+    ASSERT_EQ(stats.getPropertyValue("Misses"), 0);
+    ASSERT_EQ(stats.getPropertyValue("BytesInUse"), 0);
+    ASSERT_EQ(stats.getPropertyValue("HighWaterMark"), 0);
+
+    void* first = allocator.allocate(nullptr, 100, 8);
+    void* second = allocator.allocate(nullptr, 100, 8);
+    ASSERT_EQ(stats.getPropertyValue("BytesInUse"), 200);
+
+    allocator.free(first);
+    allocator.free(second);
+    first = allocator.allocate(nullptr, 100, 8);
+
+    ASSERT_EQ(stats.getPropertyValue("Hits"), 1);
+    ASSERT_EQ(stats.getPropertyValue("Misses"), 2);
+    ASSERT_EQ(stats.getPropertyValue("BytesInUse"), 100);
+    ASSERT_EQ(stats.getPropertyValue("HighWaterMark"), 200);
+
+    ASSERT_THROW(stats.setPropertyValue("Hits", 10), AccessDeniedException);
+
+    allocator.free(first);
+}
+
+TEST_F(PoolAllocatorTest, PacketsReuseMemory)
+{
+    const auto descriptor = DataDescriptorBuilder().setSampleType(SampleType::Float64).build();
+    auto allocator = PoolAllocator();
+
+    void* firstData;
+    {
+        const auto packet = DataPacket(descriptor, 100, nullptr, allocator);
+        firstData = packet.getRawData();
+    }
+
+    const auto packet = DataPacket(descriptor, 100, nullptr, allocator);
+    ASSERT_EQ(packet.getRawData(), firstData);
+    ASSERT_EQ(allocator.asPtr<IPropertyObject>().getPropertyValue("Hits"), 1);
+}
+
+END_NAMESPACE_OPENDAQ
@@ -0,0 +1,232 @@
+#include <opendaq/scaling_kernels.h>
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <vector>
+
+using ScalingKernelsTest = testing::Test;
+
+BEGIN_NAMESPACE_OPENDAQ
+
+namespace scaling_kernels_test
+{
+
+// Odd count so every kernel also runs its scalar tail
+static constexpr SizeT SampleCount = 1037;
+
+static std::vector<SimdLevel> getTestedLevels()
+{
+    const auto supported = getSimdLevel();
+    std::vector<SimdLevel> levels;
+    for (auto level : {SimdLevel::Neon, SimdLevel::Avx2, SimdLevel::Avx512})
+    {
+        if (level == supported || (supported == SimdLevel::Avx512 && level == SimdLevel::Avx2))
+            levels.push_back(level);
+    }
+    return levels;
+}
+
+template <typename T>
+static std::vector<T> createInput()
+{
+    std::vector<T> input(SampleCount);
+    uint64_t state = 0x9E3779B97F4A7C15ull;
+    for (SizeT i = 0; i < SampleCount; ++i)
+    {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        if constexpr (std::is_floating_point_v<T>)
+            input[i] = static_cast<T>(static_cast<int64_t>(state >> 16) % 2000000) / static_cast<T>(7.3);
+        else
+            input[i] = static_cast<T>(state >> 7);
+    }
+    return input;
+}
+
+template <typename T, typename U>
+static void testScaleKernels()
+{
+    const auto input = createInput<T>();
+    const U scale = static_cast<U>(0.37);
+    const U offset = static_cast<U>(-12.5);
+
+    // The volatile product keeps the compiler from fusing the reference into a multiply-add
+    std::vector<U> expected(SampleCount);
+    for (SizeT i = 0; i < SampleCount; ++i)
+    {
+        volatile U product = scale * static_cast<U>(input[i]);
+        expected[i] = product + offset;
+    }
+
+    ASSERT_EQ((getLinearScaleKernel<T, U>(SimdLevel::Scalar)), nullptr);
+
+    std::vector<U> scalarOutput(SampleCount);
+    getScalarLinearScaleKernel<T, U>()(input.data(), scalarOutput.data(), SampleCount, scale, offset);
+    for (SizeT i = 0; i < SampleCount; ++i)
+        ASSERT_EQ(scalarOutput[i], expected[i]) << "scalar, sample " << i;
+
+    for (auto level : getTestedLevels())
+    {
+        const auto kernel = getLinearScaleKernel<T, U>(level);
+        if (!kernel)
+            continue;
+
+        std::vector<U> output(SampleCount);
+        kernel(input.data(), output.data(), SampleCount, scale, offset);
+        for (SizeT i = 0; i < SampleCount; ++i)
+            ASSERT_EQ(output[i], expected[i]) << "level " << static_cast<int>(level) << ", sample " << i;
+    }
+}
+
+template <typename T>
+static void testScaleKernelsForInput()
+{
+    testScaleKernels<T, float>();
+    testScaleKernels<T, double>();
+}
+
+template <typename T>
+static void testRuleKernels(T delta, T offset)
+{
+    std::vector<T> expected(SampleCount);
+    for (SizeT i = 0; i < SampleCount; ++i)
+    {
+        volatile T product = delta * static_cast<T>(i);
+        expected[i] = product + offset;
+    }
+
+    ASSERT_EQ(getLinearRuleKernel<T>(SimdLevel::Scalar), nullptr);
+
+    std::vector<T> scalarOutput(SampleCount);
+    getScalarLinearRuleKernel<T>()(scalarOutput.data(), SampleCount, delta, offset);
+    for (SizeT i = 0; i < SampleCount; ++i)
+        ASSERT_EQ(scalarOutput[i], expected[i]) << "scalar, sample " << i;
+
+    for (auto level : getTestedLevels())
+    {
+        const auto kernel = getLinearRuleKernel<T>(level);
+        if (!kernel)
+            continue;
+
+        std::vector<T> output(SampleCount);
+        kernel(output.data(), SampleCount, delta, offset);
+        for (SizeT i = 0; i < SampleCount; ++i)
+            ASSERT_EQ(output[i], expected[i]) << "level " << static_cast<int>(level) << ", sample " << i;
+    }
+}
+
+template <typename T, typename U>
+static void testConvertKernels()
+{
+    // The test inputs overflow the integer types, and there are no kernels for these conversions
+    if constexpr (std::is_floating_point_v<T> && std::is_integral_v<U>)
+    {
+        ASSERT_EQ((getConvertKernel<T, U>(getSimdLevel())), nullptr);
+        return;
+    }
+
+    const auto input = createInput<T>();
+
+    std::vector<U> expected(SampleCount);
+    for (SizeT i = 0; i < SampleCount; ++i)
+        expected[i] = static_cast<U>(input[i]);
+
+    ASSERT_EQ((getConvertKernel<T, U>(SimdLevel::Scalar)), nullptr);
+
+    for (auto level : getTestedLevels())
+    {
+        const auto kernel = getConvertKernel<T, U>(level);
+        if (!kernel)
+            continue;
+
+        std::vector<U> output(SampleCount);
+        kernel(input.data(), output.data(), SampleCount);
+        for (SizeT i = 0; i < SampleCount; ++i)
+            ASSERT_EQ(output[i], expected[i]) << "level " << static_cast<int>(level) << ", sample " << i;
+    }
+}
+
+template <typename T>
+static void testConvertKernelsForInput()
+{
+    testConvertKernels<T, float>();
+    testConvertKernels<T, double>();
+    testConvertKernels<T, uint8_t>();
+    testConvertKernels<T, int8_t>();
+    testConvertKernels<T, uint16_t>();
+    testConvertKernels<T, int16_t>();
+    testConvertKernels<T, uint32_t>();
+    testConvertKernels<T, int32_t>();
+    testConvertKernels<T, uint64_t>();
+    testConvertKernels<T, int64_t>();
+}
+
+}
+
+using namespace scaling_kernels_test;
+
+TEST_F(ScalingKernelsTest, ScaleFloat)
+{
+    testScaleKernelsForInput<float>();
+    testScaleKernelsForInput<double>();
+}
+
+TEST_F(ScalingKernelsTest, ScaleInt8)
+{
+    testScaleKernelsForInput<int8_t>();
+    testScaleKernelsForInput<uint8_t>();
+}
+
+TEST_F(ScalingKernelsTest, ScaleInt16)
+{
+    testScaleKernelsForInput<int16_t>();
+    testScaleKernelsForInput<uint16_t>();
+}
+
+TEST_F(ScalingKernelsTest, ScaleInt32)
+{
+    testScaleKernelsForInput<int32_t>();
+    testScaleKernelsForInput<uint32_t>();
+}
+
+TEST_F(ScalingKernelsTest, ScaleInt64)
+{
+    testScaleKernelsForInput<int64_t>();
+    testScaleKernelsForInput<uint64_t>();
+}
+
+TEST_F(ScalingKernelsTest, ConvertFloat)
+{
+    testConvertKernelsForInput<float>();
+    testConvertKernelsForInput<double>();
+}
+
+TEST_F(ScalingKernelsTest, ConvertInteger)
+{
+    testConvertKernelsForInput<int8_t>();
+    testConvertKernelsForInput<uint8_t>();
+    testConvertKernelsForInput<int16_t>();
+    testConvertKernelsForInput<uint16_t>();
+    testConvertKernelsForInput<int32_t>();
+    testConvertKernelsForInput<uint32_t>();
+    testConvertKernelsForInput<int64_t>();
+    testConvertKernelsForInput<uint64_t>();
+}
+
+TEST_F(ScalingKernelsTest, RuleFloat)
+{
+    testRuleKernels<float>(0.25f, 1000.5f);
+    testRuleKernels<double>(1e-3, -5.0);
+}
+
+TEST_F(ScalingKernelsTest, RuleInteger)
+{
+    testRuleKernels<int8_t>(3, -100);
+    testRuleKernels<uint8_t>(7, 200);
+    testRuleKernels<int16_t>(-11, 30000);
+    testRuleKernels<uint16_t>(97, 1);
+    testRuleKernels<int32_t>(1000, -7);
+    testRuleKernels<uint32_t>(3, 0xFFFFFF00u);
+    testRuleKernels<int64_t>(1000000007, -123456789012);
+    testRuleKernels<uint64_t>(13, 5);
+}
+
+END_NAMESPACE_OPENDAQ
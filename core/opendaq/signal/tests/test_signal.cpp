@@ -5,12 +5,14 @@
 #include <opendaq/context_factory.h>
 #include <opendaq/data_descriptor_factory.h>
 #include <opendaq/deserialize_component_ptr.h>
+#include <opendaq/input_port_factory.h>
 #include <opendaq/packet_factory.h>
 #include <opendaq/removable_ptr.h>
 #include <opendaq/signal_events.h>
 #include <opendaq/signal_exceptions.h>
 #include <opendaq/signal_factory.h>
 #include <opendaq/signal_private_ptr.h>
+#include <opendaq/signal_utils.h>
 #include <opendaq/tags_factory.h>
 
 using SignalTest = testing::Test;
@@ -21,6 +23,7 @@ class ConnectionMockImpl : public ImplementationOf<IConnection>
 {
 public:
     bool packetEnqueued{false};
+    size_t enqueueMultipleCount{0};
 
     ErrCode INTERFACE_FUNC enqueue(IPacket* packet) override
     {
@@ -34,6 +37,13 @@ public:
         return OPENDAQ_SUCCESS;
     }
 
+    ErrCode INTERFACE_FUNC enqueueMultiple(IList* packets) override
+    {
+        packetEnqueued = true;
+        enqueueMultipleCount++;
+        return OPENDAQ_SUCCESS;
+    }
+
     ErrCode INTERFACE_FUNC dequeue(IPacket** packet) override
     {
         return OPENDAQ_SUCCESS;
@@ -74,6 +84,16 @@ public:
         *remote = False;
         return OPENDAQ_SUCCESS;
     }
+
+    ErrCode INTERFACE_FUNC dequeueAll(IList** packets) override
+    {
+        return OPENDAQ_SUCCESS;
+    }
+
+    ErrCode INTERFACE_FUNC dequeueUpTo(SizeT count, IList** packets) override
+    {
+        return OPENDAQ_SUCCESS;
+    }
 };
 
 class PacketMockImpl : public ImplementationOf<IPacket>
@@ -344,6 +364,127 @@ TEST_F(SignalTest, SendPacket)
     ASSERT_TRUE(connImpl->packetEnqueued);
 }
 
+TEST_F(SignalTest, SendPackets)
+{
+    const auto signal = Signal(NullContext(), nullptr, "sig");
+
+    auto connImpl = new ConnectionMockImpl();
+    ConnectionPtr conn;
+    checkErrorInfo(connImpl->queryInterface(IConnection::Id, reinterpret_cast<void**>(&conn)));
+
+    signal.asPtr<ISignalEvents>()->listenerConnected(conn);
+    connImpl->packetEnqueued = false;
+
+    signal.sendPackets(List<IPacket>(PacketMock(), PacketMock()));
+
+    ASSERT_TRUE(connImpl->packetEnqueued);
+}
+
+TEST_F(SignalTest, SendPacketsThroughInputPort)
+{
+    const auto signal = Signal(NullContext(), nullptr, "sig");
+    const auto port = InputPort(NullContext(), nullptr, "port");
+    port.connect(signal);
+
+    const auto connection = port.getConnection();
+    ASSERT_EQ(connection.getPacketCount(), 1u);
+
+    auto descriptor = DataDescriptorBuilder().setSampleType(SampleType::Int64).build();
+    signal.sendPackets(List<IPacket>(DataPacket(descriptor, 5), DataPacket(descriptor, 10)));
+
+    ASSERT_EQ(connection.getPacketCount(), 3u);
+    ASSERT_EQ(connection.getAvailableSamples(), 15u);
+}
+
+TEST_F(SignalTest, GetLastValueAfterSendPackets)
+{
+    const auto signal = Signal(NullContext(), nullptr, "sig");
+    auto descriptor = DataDescriptorBuilder().setName("test").setSampleType(SampleType::Int64).build();
+
+    auto firstPacket = DataPacket(descriptor, 1);
+    static_cast<int64_t*>(firstPacket.getData())[0] = 1;
+    auto secondPacket = DataPacket(descriptor, 1);
+    static_cast<int64_t*>(secondPacket.getData())[0] = 2;
+    auto emptyPacket = DataPacket(descriptor, 0);
+
+    signal.sendPackets(List<IPacket>(firstPacket, secondPacket, emptyPacket));
+
+    IntegerPtr integerPtr;
+    ASSERT_NO_THROW(integerPtr = signal.getLastValue().asPtr<IInteger>());
+    ASSERT_EQ(integerPtr, 2);
+}
+
+TEST_F(SignalTest, SendPacketsNullPacket)
+{
+    const auto signal = Signal(NullContext(), nullptr, "sig");
+
+    auto connImpl = new ConnectionMockImpl();
+    ConnectionPtr conn;
+    checkErrorInfo(connImpl->queryInterface(IConnection::Id, reinterpret_cast<void**>(&conn)));
+
+    signal.asPtr<ISignalEvents>()->listenerConnected(conn);
+    connImpl->packetEnqueued = false;
+
+    auto packets = List<IPacket>(PacketMock());
+    packets.pushBack(nullptr);
+
+    ASSERT_EQ(signal->sendPackets(packets), OPENDAQ_ERR_ARGUMENT_NULL);
+    ASSERT_FALSE(connImpl->packetEnqueued);
+}
+
+TEST_F(SignalTest, SendPacketsToSignals)
+{
+    const auto firstSignal = Signal(NullContext(), nullptr, "first");
+    const auto secondSignal = Signal(NullContext(), nullptr, "second");
+
+    auto firstConnImpl = new ConnectionMockImpl();
+    ConnectionPtr firstConn;
+    checkErrorInfo(firstConnImpl->queryInterface(IConnection::Id, reinterpret_cast<void**>(&firstConn)));
+    firstSignal.asPtr<ISignalEvents>()->listenerConnected(firstConn);
+
+    auto secondConnImpl = new ConnectionMockImpl();
+    ConnectionPtr secondConn;
+    checkErrorInfo(secondConnImpl->queryInterface(IConnection::Id, reinterpret_cast<void**>(&secondConn)));
+    secondSignal.asPtr<ISignalEvents>()->listenerConnected(secondConn);
+
+    sendPacketsToSignals({{firstSignal, List<IPacket>(PacketMock())},
+                          {secondSignal, List<IPacket>(PacketMock())},
+                          {firstSignal, List<IPacket>(PacketMock(), PacketMock())}});
+
+    ASSERT_EQ(firstConnImpl->enqueueMultipleCount, 1u);
+    ASSERT_EQ(secondConnImpl->enqueueMultipleCount, 1u);
+}
+
+TEST_F(SignalTest, SendPacketsToSignalsThroughInputPorts)
+{
+    const auto domainSignal = Signal(NullContext(), nullptr, "domain");
+    const auto valueSignal = Signal(NullContext(), nullptr, "value");
+    const auto domainPort = InputPort(NullContext(), nullptr, "domainPort");
+    const auto valuePort = InputPort(NullContext(), nullptr, "valuePort");
+    domainPort.connect(domainSignal);
+    valuePort.connect(valueSignal);
+
+    const auto domainConnection = domainPort.getConnection();
+    const auto valueConnection = valuePort.getConnection();
+    domainConnection.dequeue();
+    valueConnection.dequeue();
+
+    auto descriptor = DataDescriptorBuilder().setSampleType(SampleType::Int64).build();
+    const auto firstDomainPacket = DataPacket(descriptor, 5);
+    const auto secondDomainPacket = DataPacket(descriptor, 10);
+    const auto valuePacket = DataPacket(descriptor, 5);
+
+    sendPacketsToSignals({{domainSignal, List<IPacket>(firstDomainPacket)},
+                          {valueSignal, List<IPacket>(valuePacket)},
+                          {domainSignal, List<IPacket>(secondDomainPacket)}});
+
+    ASSERT_EQ(domainConnection.getPacketCount(), 2u);
+    ASSERT_EQ(domainConnection.dequeue(), firstDomainPacket);
+    ASSERT_EQ(domainConnection.dequeue(), secondDomainPacket);
+    ASSERT_EQ(valueConnection.getPacketCount(), 1u);
+    ASSERT_EQ(valueConnection.dequeue(), valuePacket);
+}
+
 TEST_F(SignalTest, SetDescriptorWithConnection)
 {
     const auto signal = Signal(NullContext(), nullptr, "sig");
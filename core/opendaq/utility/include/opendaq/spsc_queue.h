@@ -0,0 +1,174 @@
+/*
+ * Copyright 2022-2023 Blueberry d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <coretypes/common.h>
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @brief Bounded lock-free single-producer/single-consumer ring with an unbounded fallback.
+ *
+ * Items are stored in a power-of-two sized ring. The producer and the consumer only share
+ * the head and tail indices, so pushing and popping never block each other. When the ring is full,
+ * items spill into a mutex-protected overflow deque. While the overflow holds items, the producer
+ * keeps appending to it so FIFO order is preserved; the consumer drains the ring first and then
+ * the overflow, after which the producer returns to the ring.
+ *
+ * At most one thread may call producer methods (`push`) and at most one thread may call consumer
+ * methods (`pop`, `front`, `clear`) at any time. `size` and `empty` may be called from any thread.
+ */
+template <typename T>
+class SpscQueue
+{
+public:
+    static constexpr size_t DefaultCapacity = 64;
+
+    explicit SpscQueue(size_t capacity = DefaultCapacity)
+        : capacity(roundUpToPowerOfTwo(capacity))
+        , mask(this->capacity - 1)
+        , ring(std::make_unique<T[]>(this->capacity))
+    {
+    }
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    // Producer
+
+    void push(T&& item)
+    {
+        if (overflowActive.load(std::memory_order_acquire))
+        {
+            std::scoped_lock lock(overflowSync);
+            if (!overflow.empty())
+            {
+                overflow.push_back(std::move(item));
+                overflowCount.fetch_add(1, std::memory_order_release);
+                return;
+            }
+
+            overflowActive.store(false, std::memory_order_release);
+        }
+
+        const size_t currentTail = tail.load(std::memory_order_relaxed);
+        if (currentTail - head.load(std::memory_order_acquire) == capacity)
+        {
+            std::scoped_lock lock(overflowSync);
+            overflow.push_back(std::move(item));
+            overflowCount.fetch_add(1, std::memory_order_release);
+            overflowActive.store(true, std::memory_order_release);
+            return;
+        }
+
+        ring[currentTail & mask] = std::move(item);
+        tail.store(currentTail + 1, std::memory_order_release);
+    }
+
+    // Consumer
+
+    bool pop(T& item)
+    {
+        const size_t currentHead = head.load(std::memory_order_relaxed);
+        if (currentHead != tail.load(std::memory_order_acquire))
+        {
+            item = std::move(ring[currentHead & mask]);
+            ring[currentHead & mask] = T{};
+            head.store(currentHead + 1, std::memory_order_release);
+            return true;
+        }
+
+        if (overflowCount.load(std::memory_order_acquire) == 0)
+            return false;
+
+        std::scoped_lock lock(overflowSync);
+        if (overflow.empty())
+            return false;
+
+        item = std::move(overflow.front());
+        overflow.pop_front();
+        overflowCount.fetch_sub(1, std::memory_order_release);
+        return true;
+    }
+
+    T* front()
+    {
+        const size_t currentHead = head.load(std::memory_order_relaxed);
+        if (currentHead != tail.load(std::memory_order_acquire))
+            return &ring[currentHead & mask];
+
+        if (overflowCount.load(std::memory_order_acquire) == 0)
+            return nullptr;
+
+        // The front of the overflow is only removed by the consumer, so the pointer stays valid
+        // until the next call to `pop` or `clear`.
+        std::scoped_lock lock(overflowSync);
+        return overflow.empty() ? nullptr : &overflow.front();
+    }
+
+    void clear()
+    {
+        T item;
+        while (pop(item))
+            item = T{};
+    }
+
+    // Any thread
+
+    size_t size() const noexcept
+    {
+        const size_t currentHead = head.load(std::memory_order_acquire);
+        const size_t currentTail = tail.load(std::memory_order_acquire);
+        return currentTail - currentHead + overflowCount.load(std::memory_order_acquire);
+    }
+
+    bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    size_t getCapacity() const noexcept
+    {
+        return capacity;
+    }
+
+private:
+    static size_t roundUpToPowerOfTwo(size_t value)
+    {
+        size_t result = 1;
+        while (result < value)
+            result <<= 1;
+        return result;
+    }
+
+    const size_t capacity;
+    const size_t mask;
+    std::unique_ptr<T[]> ring;
+
+    alignas(64) std::atomic<size_t> head{0};
+    alignas(64) std::atomic<size_t> tail{0};
+
+    alignas(64) std::atomic<bool> overflowActive{false};
+    std::atomic<size_t> overflowCount{0};
+    std::mutex overflowSync;
+    std::deque<T> overflow;
+};
+
+END_NAMESPACE_OPENDAQ
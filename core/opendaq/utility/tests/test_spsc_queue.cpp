@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+#include <opendaq/spsc_queue.h>
+#include <thread>
+
+using namespace daq;
+
+using SpscQueueTest = testing::Test;
+
+TEST_F(SpscQueueTest, CapacityRoundedToPowerOfTwo)
+{
+    SpscQueue<int> queue(5);
+    ASSERT_EQ(queue.getCapacity(), 8u);
+}
+
+TEST_F(SpscQueueTest, PushPop)
+{
+    SpscQueue<int> queue(4);
+    ASSERT_TRUE(queue.empty());
+
+    queue.push(1);
+    queue.push(2);
+    ASSERT_EQ(queue.size(), 2u);
+    ASSERT_EQ(*queue.front(), 1);
+
+    int value;
+    ASSERT_TRUE(queue.pop(value));
+    ASSERT_EQ(value, 1);
+    ASSERT_TRUE(queue.pop(value));
+    ASSERT_EQ(value, 2);
+    ASSERT_FALSE(queue.pop(value));
+    ASSERT_EQ(queue.front(), nullptr);
+}
+
+TEST_F(SpscQueueTest, OverflowPreservesOrder)
+{
+    SpscQueue<int> queue(4);
+    for (int i = 0; i < 10; ++i)
+        queue.push(int(i));
+
+    ASSERT_EQ(queue.size(), 10u);
+
+    int value;
+    for (int i = 0; i < 3; ++i)
+    {
+        ASSERT_TRUE(queue.pop(value));
+        ASSERT_EQ(value, i);
+    }
+
+    // Pushed while the overflow is still in use, must come after the overflowed items
+    queue.push(10);
+
+    for (int i = 3; i < 11; ++i)
+    {
+        ASSERT_EQ(*queue.front(), i);
+        ASSERT_TRUE(queue.pop(value));
+        ASSERT_EQ(value, i);
+    }
+
+    ASSERT_FALSE(queue.pop(value));
+
+    // Back on the ring after the overflow was drained
+    queue.push(11);
+    ASSERT_TRUE(queue.pop(value));
+    ASSERT_EQ(value, 11);
+}
+
+TEST_F(SpscQueueTest, Clear)
+{
+    SpscQueue<int> queue(2);
+    for (int i = 0; i < 5; ++i)
+        queue.push(int(i));
+
+    queue.clear();
+    ASSERT_TRUE(queue.empty());
+}
+
+TEST_F(SpscQueueTest, ConcurrentProducerConsumer)
+{
+    constexpr int count = 100000;
+    SpscQueue<int> queue(16);
+
+    std::thread producer([&queue]
+    {
+        for (int i = 0; i < count; ++i)
+            queue.push(int(i));
+    });
+
+    int expected = 0;
+    int value;
+    while (expected < count)
+    {
+        if (queue.pop(value))
+        {
+            ASSERT_EQ(value, expected);
+            ++expected;
+        }
+    }
+
+    producer.join();
+    ASSERT_TRUE(queue.empty());
+}
@@ -1,4 +1,5 @@
 #include <audio_device_module/wav_writer_fb_impl.h>
+#include <opendaq/connection_utils.h>
 #include <opendaq/event_packet_ids.h>
 #include <opendaq/event_packet_ptr.h>
 #include <opendaq/data_descriptor_ptr.h>
@@ -174,8 +175,7 @@ void WAVWriterFbImpl::processPackets()
     if (!conn.assigned())
         return;
 
-    auto packet = conn.dequeue();
-    while (packet.assigned())
+    processQueuedPackets(conn, [this](const PacketPtr& packet)
     {
         const auto packetType = packet.getType();
         if (packetType == PacketType::Event)
@@ -194,9 +194,7 @@ void WAVWriterFbImpl::processPackets()
             auto dataPacket = packet.asPtr<IDataPacket>();
             processDataPacket(dataPacket);
         }
-
-        packet = conn.dequeue();
-    }
+    });
 }
 
 END_NAMESPACE_AUDIO_DEVICE_MODULE
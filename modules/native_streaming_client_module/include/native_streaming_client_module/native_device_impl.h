@@ -26,7 +26,10 @@
 #include <opendaq/context_ptr.h>
 #include <opendaq/streaming_ptr.h>
 
+#include <boost/asio/steady_timer.hpp>
+
 #include <future>
+#include <mutex>
 
 BEGIN_NAMESPACE_OPENDAQ_NATIVE_STREAMING_CLIENT_MODULE
 
@@ -53,6 +56,7 @@ public:
 private:
     void setupProtocolClients(const ContextPtr& context);
     config_protocol::PacketBuffer doConfigRequest(const config_protocol::PacketBuffer& reqPacket);
+    std::future<config_protocol::PacketBuffer> doConfigRequestAsync(const config_protocol::PacketBuffer& reqPacket);
     void processConfigPacket(config_protocol::PacketBuffer&& packet);
     void coreEventCallback(ComponentPtr& sender, CoreEventArgsPtr& eventArgs);
     void componentAdded(const ComponentPtr& sender, const CoreEventArgsPtr& eventArgs);
@@ -64,7 +68,16 @@ private:
     LoggerComponentPtr loggerComponent;
     std::unique_ptr<config_protocol::ConfigProtocolClient<NativeDeviceImpl>> configProtocolClient;
     opendaq_native_streaming_protocol::NativeStreamingClientHandlerPtr transportProtocolClient;
-    std::unordered_map<size_t, std::promise<config_protocol::PacketBuffer>> replyPackets;
+
+    struct PendingReply
+    {
+        std::promise<config_protocol::PacketBuffer> promise;
+        // expires asynchronous requests that nobody waits for; not set for the blocking ones
+        std::shared_ptr<boost::asio::steady_timer> timeoutTimer;
+    };
+
+    std::unordered_map<size_t, PendingReply> replyPackets;
+    std::mutex replyPacketsSync;
     StreamingPtr streaming;
     WeakRefPtr<IDevice> deviceRef;
 };
@@ -33,6 +33,16 @@ NativeDeviceHelper::~NativeDeviceHelper()
         auto receiveConfigPacketCb = [](PacketBuffer&& packet) {};
         transportProtocolClient->setConfigPacketHandler(receiveConfigPacketCb);
     }
+
+    {
+        // the promises of pending asynchronous requests are broken when the map is destroyed
+        std::scoped_lock lock(replyPacketsSync);
+        for (const auto& [id, pendingReply] : replyPackets)
+        {
+            if (pendingReply.timeoutTimer)
+                pendingReply.timeoutTimer->cancel();
+        }
+    }
     processingIOContextPtr->stop();
 }
 
@@ -123,7 +133,13 @@ void NativeDeviceHelper::setupProtocolClients(const ContextPtr& context)
     {
         return this->doConfigRequest(packet);
     };
-    configProtocolClient = std::make_unique<ConfigProtocolClient<NativeDeviceImpl>>(context, sendRequestCallback, nullptr);
+    SendRequestAsyncCallback sendRequestAsyncCallback =
+        [this](const PacketBuffer& packet)
+    {
+        return this->doConfigRequestAsync(packet);
+    };
+    configProtocolClient =
+        std::make_unique<ConfigProtocolClient<NativeDeviceImpl>>(context, sendRequestCallback, nullptr, sendRequestAsyncCallback);
 
     ProcessConfigProtocolPacketCb receiveConfigPacketCb =
         [this](PacketBuffer&& packetBuffer)
@@ -141,23 +157,59 @@ void NativeDeviceHelper::setupProtocolClients(const ContextPtr& context)
 
 PacketBuffer NativeDeviceHelper::doConfigRequest(const PacketBuffer& reqPacket)
 {
-    // future/promise mechanism is used since transport client works asynchronously
+    // future/promise mechanism is used since transport client works asynchronously;
+    // requests can be issued from several threads, so more than one reply may be pending at a time
     auto reqId = reqPacket.getId();
-    replyPackets.insert({reqId, std::promise<PacketBuffer>()});
-    std::future<PacketBuffer> future = replyPackets.at(reqId).get_future();
+    std::future<PacketBuffer> future;
+    {
+        std::scoped_lock lock(replyPacketsSync);
+        future = replyPackets[reqId].promise.get_future();
+    }
     transportProtocolClient->sendConfigRequest(reqPacket);
 
-    if (future.wait_for(requestTimeout) == std::future_status::ready)
+    const auto status = future.wait_for(requestTimeout);
     {
-        auto result = future.get();
+        std::scoped_lock lock(replyPacketsSync);
         replyPackets.erase(reqId);
-        return result;
     }
-    else
+
+    if (status == std::future_status::ready)
+        return future.get();
+
+    throw GeneralErrorException("Native configuration protocol request timed out");
+}
+
+std::future<PacketBuffer> NativeDeviceHelper::doConfigRequestAsync(const PacketBuffer& reqPacket)
+{
+    // the reply completes the future in processConfigPacket, so no thread is blocked while the request is pending
+    auto reqId = reqPacket.getId();
+    auto timeoutTimer = std::make_shared<boost::asio::steady_timer>(*processingIOContextPtr, requestTimeout);
+    std::future<PacketBuffer> future;
     {
-        replyPackets.erase(reqId);
-        throw GeneralErrorException("Native configuration protocol request timed out");
+        std::scoped_lock lock(replyPacketsSync);
+        auto& pendingReply = replyPackets[reqId];
+        pendingReply.timeoutTimer = timeoutTimer;
+        future = pendingReply.promise.get_future();
     }
+
+    timeoutTimer->async_wait(processingStrand.wrap(
+        [this, reqId](const boost::system::error_code& ec)
+        {
+            // cancelled when the reply arrives or the helper is destroyed
+            if (ec)
+                return;
+
+            std::scoped_lock lock(replyPacketsSync);
+            if (auto it = replyPackets.find(reqId); it != replyPackets.end())
+            {
+                it->second.promise.set_exception(
+                    std::make_exception_ptr(GeneralErrorException("Native configuration protocol request timed out")));
+                replyPackets.erase(it);
+            }
+        }));
+
+    transportProtocolClient->sendConfigRequest(reqPacket);
+    return future;
 }
 
 void NativeDeviceHelper::processConfigPacket(PacketBuffer&& packet)
@@ -166,12 +218,19 @@ void NativeDeviceHelper::processConfigPacket(PacketBuffer&& packet)
     {
         configProtocolClient->triggerNotificationPacket(packet);
     }
-    else if(auto it = replyPackets.find(packet.getId()); it != replyPackets.end())
-    {
-        it->second.set_value(std::move(packet));
-    }
     else
     {
+        std::unique_lock lock(replyPacketsSync);
+        if (auto it = replyPackets.find(packet.getId()); it != replyPackets.end())
+        {
+            it->second.promise.set_value(std::move(packet));
+            if (it->second.timeoutTimer)
+                it->second.timeoutTimer->cancel();
+            replyPackets.erase(it);
+            return;
+        }
+        lock.unlock();
+
         LOG_E("Received reply for unknown request id {}, reply type {:#x} [{}]",
             packet.getId(),
             static_cast<uint8_t>(packet.getPacketType()),
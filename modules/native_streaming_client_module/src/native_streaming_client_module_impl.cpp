@@ -281,6 +281,8 @@ PropertyObjectPtr NativeStreamingClientModule::createTransportLayerDefaultConfig
     transportLayerConfig.addProperty(daq::IntProperty("ConnectionTimeout", 1000));
     transportLayerConfig.addProperty(daq::IntProperty("StreamingInitTimeout", 1000));
     transportLayerConfig.addProperty(daq::IntProperty("ReconnectionPeriod", 1000));
+    transportLayerConfig.addProperty(daq::BoolProperty("BinaryEventPackets", daq::True));
+    transportLayerConfig.addProperty(daq::BoolProperty("PayloadCompression", daq::False));
 
     populateTransportLayerConfigFromContext(transportLayerConfig);
 
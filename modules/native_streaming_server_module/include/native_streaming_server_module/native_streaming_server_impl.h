@@ -24,6 +24,9 @@
 
 #include <native_streaming_protocol/native_streaming_server_handler.h>
 
+#include <atomic>
+#include <condition_variable>
+
 BEGIN_NAMESPACE_OPENDAQ_NATIVE_STREAMING_SERVER_MODULE
 
 class NativeStreamingServerImpl : public daq::Server
@@ -40,12 +43,39 @@ protected:
 
     std::shared_ptr<opendaq_native_streaming_protocol::NativeStreamingServerHandler> serverHandler;
 
+    struct SignalReader;
+
+    // Forwards the packets of the signals assigned to it, so the packets of each signal are sent in order
+    struct ReadWorker
+    {
+        std::thread thread;
+        bool active{false};
+
+        // Held while forwarding packets, so a removed reader is no longer read once removeReader returns
+        std::mutex readSync;
+
+        // Readers with pending packets, filled from the packet notification path and drained by the worker thread
+        std::mutex readySync;
+        std::condition_variable readyCondition;
+        std::vector<std::shared_ptr<SignalReader>> readyReaders;
+    };
+
+    struct SignalReader
+    {
+        SignalPtr signal;
+        PacketReaderPtr reader;
+        std::shared_ptr<ReadWorker> worker;
+        std::atomic<bool> ready{false};
+        bool removed{false};
+    };
+
     void startReading();
     void stopReading();
-    void startReadThread();
+    void startReadThread(ReadWorker& worker);
     void createReaders();
     void addReader(SignalPtr signalToRead);
     void removeReader(SignalPtr signalToRead);
+    void markReaderReady(const std::shared_ptr<SignalReader>& signalReader);
 
     void startTransportOperations();
     void stopTransportOperations();
@@ -57,11 +87,12 @@ protected:
     void componentRemoved(ComponentPtr& sender, CoreEventArgsPtr& eventArgs);
     void coreEventCallback(ComponentPtr& sender, CoreEventArgsPtr& eventArgs);
 
-    std::thread readThread;
-    bool readThreadActive;
-    std::chrono::milliseconds readThreadSleepTime;
-    std::vector<std::pair<SignalPtr, PacketReaderPtr>> signalReaders;
+    // Empty while the server is not reading, in which case subscribed signals are not forwarded
+    std::vector<std::shared_ptr<ReadWorker>> readWorkers;
+    size_t nextReadWorker;
+    std::vector<std::shared_ptr<SignalReader>> signalReaders;
 
+    // Runs on a single thread, see startTransportOperations
     std::shared_ptr<boost::asio::io_context> transportIOContextPtr;
     std::thread transportThread;
 
@@ -23,8 +23,7 @@ using namespace config_protocol;
 
 NativeStreamingServerImpl::NativeStreamingServerImpl(DevicePtr rootDevice, PropertyObjectPtr config, const ContextPtr& context)
     : Server(config, rootDevice, context, nullptr)
-    , readThreadActive(false)
-    , readThreadSleepTime(std::chrono::milliseconds(20))
+    , nextReadWorker(0)
     , transportIOContextPtr(std::make_shared<boost::asio::io_context>())
     , processingStrand(processingIOContext)
     , logger(context.getLogger())
@@ -34,6 +33,10 @@ NativeStreamingServerImpl::NativeStreamingServerImpl(DevicePtr rootDevice, Prope
     startTransportOperations();
 
     prepareServerHandler();
+
+    // Workers have to be running before the clients can subscribe to signals
+    startReading();
+
     const uint16_t port = config.getPropertyValue("NativeStreamingPort");
     serverHandler->startServer(port);
 
@@ -43,8 +46,6 @@ NativeStreamingServerImpl::NativeStreamingServerImpl(DevicePtr rootDevice, Prope
     checkErrorInfo(errCode);
 
     this->context.getOnCoreEvent() += event(&NativeStreamingServerImpl::coreEventCallback);
-
-    startReading();
 }
 
 NativeStreamingServerImpl::~NativeStreamingServerImpl()
@@ -113,6 +114,10 @@ void NativeStreamingServerImpl::coreEventCallback(ComponentPtr& sender, CoreEven
 
 void NativeStreamingServerImpl::startTransportOperations()
 {
+    // The io_context is deliberately run by one thread only. The native streaming library creates all accepted
+    // sessions on this io_context and does not serialize the handlers of a session with a strand, so running it
+    // on a thread pool would let the reads and writes of one session execute concurrently. Packet encoding and
+    // batching, the expensive part of streaming, is spread across the read workers instead (StreamingThreadCount).
     transportThread = std::thread(
         [this]()
         {
@@ -215,18 +220,29 @@ void NativeStreamingServerImpl::prepareServerHandler()
         return processConfigRequestCb;
     };
 
+    // Configurations created before the batching options were introduced fall back to the defaults
+    Int maxPacketBatchSize = 65536;
+    Int maxPacketBatchLatency = 0;
+    if (serverConfig.hasProperty("MaxPacketBatchSize"))
+        maxPacketBatchSize = serverConfig.getPropertyValue("MaxPacketBatchSize");
+    if (serverConfig.hasProperty("MaxPacketBatchLatency"))
+        maxPacketBatchLatency = serverConfig.getPropertyValue("MaxPacketBatchLatency");
+
     serverHandler = std::make_shared<NativeStreamingServerHandler>(context,
                                                                    transportIOContextPtr,
                                                                    rootDevice.getSignals(search::Recursive(search::Any())),
                                                                    signalSubscribedHandler,
                                                                    signalUnsubscribedHandler,
-                                                                   createConfigServerCb);
+                                                                   createConfigServerCb,
+                                                                   static_cast<size_t>(maxPacketBatchSize),
+                                                                   std::chrono::milliseconds(maxPacketBatchLatency));
 }
 
 PropertyObjectPtr NativeStreamingServerImpl::createDefaultConfig()
 {
     constexpr Int minPortValue = 0;
     constexpr Int maxPortValue = 65535;
+    constexpr Int minBatchValue = 0;
 
     auto defaultConfig = PropertyObject();
 
@@ -236,6 +252,24 @@ PropertyObjectPtr NativeStreamingServerImpl::createDefaultConfig()
         .build();
     defaultConfig.addProperty(websocketPortProp);
 
+    // Streamed packets of a client are gathered into a single write until the batch reaches this many bytes
+    const auto maxPacketBatchSizeProp = IntPropertyBuilder("MaxPacketBatchSize", 65536)
+        .setMinValue(minBatchValue)
+        .build();
+    defaultConfig.addProperty(maxPacketBatchSizeProp);
+
+    // Time in milliseconds a partially filled batch may wait for more packets; 0 flushes after each read pass
+    const auto maxPacketBatchLatencyProp = IntPropertyBuilder("MaxPacketBatchLatency", 0)
+        .setMinValue(minBatchValue)
+        .build();
+    defaultConfig.addProperty(maxPacketBatchLatencyProp);
+
+    // Number of threads the streamed signals are distributed across for reading and sending their packets
+    const auto streamingThreadCountProp = IntPropertyBuilder("StreamingThreadCount", 1)
+        .setMinValue(1)
+        .build();
+    defaultConfig.addProperty(streamingThreadCountProp);
+
     return defaultConfig;
 }
 
@@ -266,45 +300,114 @@ void NativeStreamingServerImpl::onStopServer()
 
 void NativeStreamingServerImpl::startReading()
 {
-    readThreadActive = true;
-    this->readThread = std::thread([this]()
+    // Configurations created before the option was introduced fall back to a single worker
+    Int workerCount = 1;
+    if (serverConfig.hasProperty("StreamingThreadCount"))
+        workerCount = serverConfig.getPropertyValue("StreamingThreadCount");
+
+    std::scoped_lock lock(readersSync);
+    for (Int i = 0; i < std::max<Int>(workerCount, 1); ++i)
     {
-        this->startReadThread();
-        LOG_I("Reading thread finished");
-    });
+        auto worker = std::make_shared<ReadWorker>();
+        worker->active = true;
+        worker->thread = std::thread([this, workerPtr = worker.get()]()
+        {
+            this->startReadThread(*workerPtr);
+            LOG_I("Reading thread finished");
+        });
+        readWorkers.push_back(std::move(worker));
+    }
 }
 
 void NativeStreamingServerImpl::stopReading()
 {
-    readThreadActive = false;
-    if (readThread.joinable())
+    // The workers are taken out of the list, so signals subscribed from now on are no longer assigned to them
+    std::vector<std::shared_ptr<ReadWorker>> workers;
     {
-        readThread.join();
-        LOG_I("Reading thread joined");
+        std::scoped_lock lock(readersSync);
+        for (const auto& signalReader : signalReaders)
+            signalReader->reader.setOnDataAvailable(nullptr);
+        signalReaders.clear();
+        std::swap(workers, readWorkers);
     }
 
-    signalReaders.clear();
+    for (const auto& worker : workers)
+    {
+        {
+            std::scoped_lock lock(worker->readySync);
+            worker->active = false;
+            worker->readyReaders.clear();
+        }
+        worker->readyCondition.notify_all();
+    }
+
+    for (const auto& worker : workers)
+    {
+        if (worker->thread.joinable())
+        {
+            worker->thread.join();
+            LOG_I("Reading thread joined");
+        }
+    }
 }
 
-void NativeStreamingServerImpl::startReadThread()
+void NativeStreamingServerImpl::startReadThread(ReadWorker& worker)
 {
-    while (readThreadActive)
+    std::vector<std::shared_ptr<SignalReader>> pendingReaders;
+    std::vector<std::shared_ptr<ServerSessionHandler>> writtenSessions;
+
+    while (true)
     {
         {
-            std::scoped_lock lock(readersSync);
-            for (const auto& [signal, reader] : signalReaders)
+            std::unique_lock lock(worker.readySync);
+            worker.readyCondition.wait(lock, [&worker] { return !worker.active || !worker.readyReaders.empty(); });
+            if (!worker.active)
+                break;
+
+            std::swap(pendingReaders, worker.readyReaders);
+        }
+
+        {
+            // Only the worker's own lock is held, so the workers forward their signals in parallel
+            std::scoped_lock lock(worker.readSync);
+            for (const auto& signalReader : pendingReaders)
             {
-                PacketPtr packet = reader.read();
+                if (signalReader->removed)
+                    continue;
+
+                // Cleared before reading so that packets arriving meanwhile mark the reader ready again
+                signalReader->ready.store(false, std::memory_order_release);
+
+                PacketPtr packet = signalReader->reader.read();
                 while (packet.assigned())
                 {
-                    serverHandler->sendPacket(signal, packet);
-                    packet = reader.read();
+                    serverHandler->sendPacket(signalReader->signal, packet, writtenSessions);
+                    packet = signalReader->reader.read();
                 }
             }
         }
 
-        std::this_thread::sleep_for(readThreadSleepTime);
+        // Only the sessions this worker wrote to are flushed, so the batches of other workers are left intact
+        serverHandler->flushPendingPackets(writtenSessions);
+
+        pendingReaders.clear();
+    }
+}
+
+void NativeStreamingServerImpl::markReaderReady(const std::shared_ptr<SignalReader>& signalReader)
+{
+    if (signalReader->ready.exchange(true, std::memory_order_acq_rel))
+        return;
+
+    auto& worker = *signalReader->worker;
+    {
+        // A notification racing with stopReading must not queue the reader on a stopped worker
+        std::scoped_lock lock(worker.readySync);
+        if (!worker.active)
+            return;
+        worker.readyReaders.push_back(signalReader);
     }
+    worker.readyCondition.notify_one();
 }
 
 void NativeStreamingServerImpl::createReaders()
@@ -322,30 +425,57 @@ void NativeStreamingServerImpl::addReader(SignalPtr signalToRead)
 {
     auto it = std::find_if(signalReaders.begin(),
                            signalReaders.end(),
-                           [&signalToRead](const std::pair<SignalPtr, PacketReaderPtr>& element)
+                           [&signalToRead](const std::shared_ptr<SignalReader>& element)
                            {
-                               return element.first == signalToRead;
+                               return element->signal == signalToRead;
                            });
     if (it != signalReaders.end())
         return;
 
+    if (readWorkers.empty())
+    {
+        LOG_W("Signal {} is not read as the server is stopped", signalToRead.getGlobalId());
+        return;
+    }
+
     LOG_I("Add reader for signal {}", signalToRead.getGlobalId());
-    auto reader = PacketReader(signalToRead);
-    signalReaders.push_back(std::pair<SignalPtr, PacketReaderPtr>({signalToRead, reader}));
+    auto signalReader = std::make_shared<SignalReader>();
+    signalReader->signal = signalToRead;
+    signalReader->reader = PacketReader(signalToRead);
+
+    // Each signal is forwarded by a single worker, which keeps its packets in order
+    signalReader->worker = readWorkers[nextReadWorker++ % readWorkers.size()];
+
+    // The notification runs on the thread that sent the packet, so it only marks the reader as ready
+    // and leaves reading and sending to the read thread
+    std::weak_ptr<SignalReader> signalReaderWeak = signalReader;
+    signalReader->reader.setOnDataAvailable([this, signalReaderWeak]
+    {
+        if (const auto signalReader = signalReaderWeak.lock())
+            markReaderReady(signalReader);
+    });
+
+    signalReaders.push_back(signalReader);
+
+    // Packets enqueued on connect (e.g. the initial descriptor-changed event) precede the notification callback
+    markReaderReady(signalReader);
 }
 
 void NativeStreamingServerImpl::removeReader(SignalPtr signalToRead)
 {
     auto it = std::find_if(signalReaders.begin(),
                            signalReaders.end(),
-                           [&signalToRead](const std::pair<SignalPtr, PacketReaderPtr>& element)
+                           [&signalToRead](const std::shared_ptr<SignalReader>& element)
                            {
-                               return element.first == signalToRead;
+                               return element->signal == signalToRead;
                            });
     if (it == signalReaders.end())
         return;
 
     LOG_I("Remove reader for signal {}", signalToRead.getGlobalId());
+    std::scoped_lock workerLock((*it)->worker->readSync);
+    (*it)->removed = true;
+    (*it)->reader.setOnDataAvailable(nullptr);
     signalReaders.erase(it);
 }
 
@@ -115,6 +115,15 @@ TEST_F(NativeStreamingServerModuleTest, ServerConfig)
 
     ASSERT_TRUE(config.hasProperty("NativeStreamingPort"));
     ASSERT_EQ(config.getPropertyValue("NativeStreamingPort"), 7420);
+
+    ASSERT_TRUE(config.hasProperty("MaxPacketBatchSize"));
+    ASSERT_EQ(config.getPropertyValue("MaxPacketBatchSize"), 65536);
+
+    ASSERT_TRUE(config.hasProperty("MaxPacketBatchLatency"));
+    ASSERT_EQ(config.getPropertyValue("MaxPacketBatchLatency"), 0);
+
+    ASSERT_TRUE(config.hasProperty("StreamingThreadCount"));
+    ASSERT_EQ(config.getPropertyValue("StreamingThreadCount"), 1);
 }
 
 TEST_F(NativeStreamingServerModuleTest, CreateServer)
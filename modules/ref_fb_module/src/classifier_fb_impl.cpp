@@ -1,5 +1,6 @@
 #include <ref_fb_module/classifier_fb_impl.h>
 #include <ref_fb_module/dispatch.h>
+#include <opendaq/connection_utils.h>
 #include <opendaq/input_port_factory.h>
 #include <opendaq/data_descriptor_ptr.h>
 #include <opendaq/event_packet_ptr.h>
@@ -266,7 +267,6 @@ void ClassifierFbImpl::onPacketReceived(const InputPortPtr& port)
 {
     std::scoped_lock lock(sync);
 
-    PacketPtr packet;
     const auto connection = inputPort.getConnection();
     if (!connection.assigned())
         return;
@@ -280,9 +280,7 @@ void ClassifierFbImpl::onPacketReceived(const InputPortPtr& port)
     if (linearReader.assigned())
         return;
 
-    packet = connection.dequeue();
-
-    while (packet.assigned())
+    processQueuedPackets(connection, [this](const PacketPtr& packet)
     {
         switch (packet.getType())
         {
@@ -297,9 +295,7 @@ void ClassifierFbImpl::onPacketReceived(const InputPortPtr& port)
             default:
                 break;
         }
-
-        packet = connection.dequeue();
-    };
+    });
 }
 
 void ClassifierFbImpl::processEventPacket(const EventPacketPtr& packet)
@@ -2,6 +2,7 @@
 #include <ref_fb_module/arial.ttf.h>
 #include <ref_fb_module/renderer_fb_impl.h>
 
+#include <opendaq/connection_utils.h>
 #include <opendaq/event_packet_ids.h>
 #include <opendaq/event_packet_params.h>
 #include <opendaq/event_packet_ptr.h>
@@ -1129,8 +1130,7 @@ void RendererFbImpl::processSignalContext(SignalContext& signalContext)
     if (!conn.assigned())
         return;
 
-    PacketPtr packet = conn.dequeue();
-    while (packet.assigned())
+    processQueuedPackets(conn, [this, &signalContext](const PacketPtr& packet)
     {
         if (packet.supportsInterface<IEventPacket>())
         {
@@ -1148,9 +1148,7 @@ void RendererFbImpl::processSignalContext(SignalContext& signalContext)
             auto dataPacket = packet.asPtr<IDataPacket>();
             processDataPacket(signalContext, dataPacket);
         }
-
-        packet = conn.dequeue();
-    }
+    });
 }
 
 void RendererFbImpl::processSignalDescriptorChanged(SignalContext& signalContext, const DataDescriptorPtr& valueSignalDescriptor, const DataDescriptorPtr& domainSignalDescriptor)
@@ -1,5 +1,6 @@
 #include <ref_fb_module/scaling_fb_impl.h>
 #include <ref_fb_module/dispatch.h>
+#include <opendaq/connection_utils.h>
 #include <opendaq/input_port_factory.h>
 #include <opendaq/data_descriptor_ptr.h>
 
@@ -183,14 +184,11 @@ void ScalingFbImpl::onPacketReceived(const InputPortPtr& port)
 {
     std::scoped_lock lock(sync);
 
-    PacketPtr packet;
     const auto connection = inputPort.getConnection();
     if (!connection.assigned())
         return;
 
-    packet = connection.dequeue();
-
-    while (packet.assigned())
+    processQueuedPackets(connection, [this](const PacketPtr& packet)
     {
         switch (packet.getType())
         {
@@ -205,9 +203,7 @@ void ScalingFbImpl::onPacketReceived(const InputPortPtr& port)
             default:
                 break;
         }
-
-        packet = connection.dequeue();
-    };
+    });
 }
 
 void ScalingFbImpl::processEventPacket(const EventPacketPtr& packet)
@@ -1,4 +1,5 @@
 #include <opendaq/custom_log.h>
+#include <opendaq/connection_utils.h>
 #include <opendaq/event_packet_params.h>
 #include <opendaq/packet_factory.h>
 #include <ref_fb_module/statistics_fb_impl.h>
@@ -701,8 +702,7 @@ void StatisticsFbImpl::processTriggerPackets(const InputPortPtr& port)
     if (!conn.assigned())
         return;
 
-    auto packet = conn.dequeue();
-    while (packet.assigned())
+    processQueuedPackets(conn, [this](const PacketPtr& packet)
     {
         const auto packetType = packet.getType();
         if (packetType == PacketType::Event)
@@ -721,9 +721,7 @@ void StatisticsFbImpl::processTriggerPackets(const InputPortPtr& port)
             auto dataPacket = packet.asPtr<IDataPacket>();
             processDataPacketTrigger(dataPacket);
         }
-
-        packet = conn.dequeue();
-    }
+    });
 }
 
 void StatisticsFbImpl::processInputPackets(const InputPortPtr& port)
@@ -734,8 +732,7 @@ void StatisticsFbImpl::processInputPackets(const InputPortPtr& port)
     if (!conn.assigned())
         return;
 
-    auto packet = conn.dequeue();
-    while (packet.assigned())
+    processQueuedPackets(conn, [this](const PacketPtr& packet)
     {
         const auto packetType = packet.getType();
         if (packetType == PacketType::Event)
@@ -754,9 +751,7 @@ void StatisticsFbImpl::processInputPackets(const InputPortPtr& port)
             auto dataPacket = packet.asPtr<IDataPacket>();
             processDataPacketInput(dataPacket);
         }
-
-        packet = conn.dequeue();
-    }
+    });
 }
 }
 
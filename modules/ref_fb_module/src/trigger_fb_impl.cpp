@@ -1,3 +1,4 @@
+#include <opendaq/connection_utils.h>
 #include <opendaq/event_packet_params.h>
 #include <ref_fb_module/dispatch.h>
 #include <ref_fb_module/trigger_fb_impl.h>
@@ -105,14 +106,11 @@ void TriggerFbImpl::onPacketReceived(const InputPortPtr& port)
 {
     std::scoped_lock lock(sync);
 
-    PacketPtr packet;
     const auto connection = inputPort.getConnection();
     if (!connection.assigned())
         return;
 
-    packet = connection.dequeue();
-
-    while (packet.assigned())
+    processQueuedPackets(connection, [this](const PacketPtr& packet)
     {
         switch (packet.getType())
         {
@@ -127,9 +125,7 @@ void TriggerFbImpl::onPacketReceived(const InputPortPtr& port)
             default:
                 break;
         }
-
-        packet = connection.dequeue();
-    };
+    });
 }
 
 void TriggerFbImpl::processEventPacket(const EventPacketPtr& packet)
@@ -1,10 +1,11 @@
 #include "test_helpers.h"
+#include <atomic>
 
 using NativeStreamingModulesTest = testing::Test;
 
 using namespace daq;
 
-static InstancePtr CreateServerInstance()
+static InstancePtr CreateServerInstance(Int streamingThreadCount = 1)
 {
     auto logger = Logger();
     auto scheduler = Scheduler(logger);
@@ -15,7 +16,9 @@ static InstancePtr CreateServerInstance()
 
     const auto refDevice = instance.addDevice("daqref://device1");
 
-    instance.addServer("openDAQ Native Streaming", nullptr);
+    auto config = instance.getAvailableServerTypes().get("openDAQ Native Streaming").createDefaultConfig();
+    config.setPropertyValue("StreamingThreadCount", streamingThreadCount);
+    instance.addServer("openDAQ Native Streaming", config);
 
     return instance;
 }
@@ -136,6 +139,160 @@ TEST_F(NativeStreamingModulesTest, SubscribeReadUnsubscribe)
     ASSERT_EQ(domainUnsubscribeFuture.get(), streamingSource);
 }
 
+TEST_F(NativeStreamingModulesTest, ReadWithMultipleStreamingThreads)
+{
+    SKIP_TEST_MAC_CI;
+    auto server = CreateServerInstance(4);
+    auto client = CreateClientInstance();
+
+    auto signals = client.getSignalsRecursive();
+    auto firstSignal = signals[0].template asPtr<IMirroredSignalConfig>();
+    auto secondSignal = signals[2].template asPtr<IMirroredSignalConfig>();
+
+    std::promise<StringPtr> firstSubscribePromise;
+    std::future<StringPtr> firstSubscribeFuture;
+    test_helpers::setupSubscribeAckHandler(firstSubscribePromise, firstSubscribeFuture, firstSignal);
+
+    std::promise<StringPtr> secondSubscribePromise;
+    std::future<StringPtr> secondSubscribeFuture;
+    test_helpers::setupSubscribeAckHandler(secondSubscribePromise, secondSubscribeFuture, secondSignal);
+
+    using namespace std::chrono_literals;
+    StreamReaderPtr firstReader = daq::StreamReader<double, uint64_t>(firstSignal);
+    StreamReaderPtr secondReader = daq::StreamReader<double, uint64_t>(secondSignal);
+
+    ASSERT_TRUE(test_helpers::waitForAcknowledgement(firstSubscribeFuture));
+    ASSERT_TRUE(test_helpers::waitForAcknowledgement(secondSubscribeFuture));
+
+    double samples[100];
+    uint64_t domain[100];
+    for (int i = 0; i < 10; ++i)
+    {
+        std::this_thread::sleep_for(100ms);
+        for (const auto& reader : {firstReader, secondReader})
+        {
+            daq::SizeT count = 100;
+            reader.readWithDomain(samples, domain, &count);
+            EXPECT_GT(count, 0u) << "iteration " << i;
+
+            // Packets of a signal are forwarded by a single thread, so the domain stays monotonic
+            for (daq::SizeT j = 1; j < count; ++j)
+                ASSERT_GT(domain[j], domain[j - 1]);
+        }
+    }
+}
+
+TEST_F(NativeStreamingModulesTest, StreamAfterSubscribe)
+{
+    SKIP_TEST_MAC_CI;
+    auto server = CreateServerInstance();
+    auto client = CreateClientInstance();
+
+    auto serverSignal = server.getSignals(search::Recursive(search::Any()))[0];
+    auto signal = client.getSignals(search::Recursive(search::Any()))[0].template asPtr<IMirroredSignalConfig>();
+
+    std::promise<StringPtr> signalSubscribePromise;
+    std::future<StringPtr> signalSubscribeFuture;
+    test_helpers::setupSubscribeAckHandler(signalSubscribePromise, signalSubscribeFuture, signal);
+
+    PacketReaderPtr reader = PacketReader(signal);
+    ASSERT_TRUE(test_helpers::waitForAcknowledgement(signalSubscribeFuture));
+
+    // the server reader is ready as soon as it is created, so the descriptor changed event enqueued on connect
+    // is streamed before the data packets without waiting for the next packet of the signal
+    EventPacketPtr descriptorChangedPacket;
+    DataPacketPtr dataPacket;
+    const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (!dataPacket.assigned() && std::chrono::steady_clock::now() < timeout)
+    {
+        const auto packet = reader.read();
+        if (!packet.assigned())
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            continue;
+        }
+
+        if (packet.getType() == PacketType::Event)
+        {
+            const EventPacketPtr eventPacket = packet;
+            if (eventPacket.getEventId() == event_packet_id::DATA_DESCRIPTOR_CHANGED)
+                descriptorChangedPacket = eventPacket;
+        }
+        else if (packet.getType() == PacketType::Data)
+        {
+            dataPacket = packet;
+        }
+    }
+
+    ASSERT_TRUE(descriptorChangedPacket.assigned());
+    ASSERT_TRUE(dataPacket.assigned());
+
+    DataDescriptorPtr dataDescriptor = descriptorChangedPacket.getParameters().get(event_packet_param::DATA_DESCRIPTOR);
+    ASSERT_EQ(dataDescriptor, serverSignal.getDescriptor());
+    ASSERT_EQ(dataPacket.getDataDescriptor(), serverSignal.getDescriptor());
+    ASSERT_GT(dataPacket.getSampleCount(), 0u);
+}
+
+TEST_F(NativeStreamingModulesTest, UnsubscribeWhileStreaming)
+{
+    SKIP_TEST_MAC_CI;
+    auto server = CreateServerInstance();
+    auto client = CreateClientInstance();
+
+    auto signals = client.getSignalsRecursive();
+    auto firstSignal = signals[0].template asPtr<IMirroredSignalConfig>();
+    auto secondSignal = signals[2].template asPtr<IMirroredSignalConfig>();
+
+    std::atomic<size_t> firstSubscribeCount{0};
+    std::atomic<size_t> firstUnsubscribeCount{0};
+    firstSignal.getOnSubscribeComplete() +=
+        [&firstSubscribeCount](MirroredSignalConfigPtr& /*sender*/, SubscriptionEventArgsPtr& /*args*/) { firstSubscribeCount++; };
+    firstSignal.getOnUnsubscribeComplete() +=
+        [&firstUnsubscribeCount](MirroredSignalConfigPtr& /*sender*/, SubscriptionEventArgsPtr& /*args*/) { firstUnsubscribeCount++; };
+
+    const auto waitForCount = [](const std::atomic<size_t>& counter, size_t expected)
+    {
+        const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+        while (counter < expected && std::chrono::steady_clock::now() < timeout)
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        return counter >= expected;
+    };
+
+    std::promise<StringPtr> secondSubscribePromise;
+    std::future<StringPtr> secondSubscribeFuture;
+    test_helpers::setupSubscribeAckHandler(secondSubscribePromise, secondSubscribeFuture, secondSignal);
+
+    using namespace std::chrono_literals;
+    StreamReaderPtr secondReader = daq::StreamReader<double, uint64_t>(secondSignal);
+    ASSERT_TRUE(test_helpers::waitForAcknowledgement(secondSubscribeFuture));
+
+    double samples[100];
+
+    // the readers of the first signal are removed while the dispatcher forwards the packets of both signals
+    for (size_t i = 1; i <= 5; ++i)
+    {
+        StreamReaderPtr firstReader = daq::StreamReader<double, uint64_t>(firstSignal);
+        ASSERT_TRUE(waitForCount(firstSubscribeCount, i)) << "iteration " << i;
+
+        std::this_thread::sleep_for(100ms);
+        daq::SizeT count = 100;
+        firstReader.read(samples, &count);
+        EXPECT_GT(count, 0u) << "iteration " << i;
+
+        firstReader.release();
+        ASSERT_TRUE(waitForCount(firstUnsubscribeCount, i)) << "iteration " << i;
+    }
+
+    // the remaining subscription keeps streaming after the other one was dropped
+    for (int i = 0; i < 5; ++i)
+    {
+        std::this_thread::sleep_for(100ms);
+        daq::SizeT count = 100;
+        secondReader.read(samples, &count);
+        EXPECT_GT(count, 0u) << "iteration " << i;
+    }
+}
+
 TEST_F(NativeStreamingModulesTest, DISABLED_RenderSignal)
 {
     auto server = CreateServerInstance();
@@ -41,6 +41,10 @@ public:
 
     ErrCode INTERFACE_FUNC isRemote(Bool* remote) override;
 
+    ErrCode INTERFACE_FUNC enqueueMultiple(IList* packets) override;
+    ErrCode INTERFACE_FUNC dequeueAll(IList** packets) override;
+    ErrCode INTERFACE_FUNC dequeueUpTo(SizeT count, IList** packets) override;
+
 private:
     InputPortConfigPtr port;
     WeakRefPtr<ISignal> signalRef;
@@ -64,6 +68,11 @@ inline ErrCode ConfigClientConnectionImpl::enqueueOnThisThread(IPacket* packet)
     return OPENDAQ_IGNORED;
 }
 
+inline ErrCode ConfigClientConnectionImpl::enqueueMultiple(IList* packets)
+{
+    return OPENDAQ_IGNORED;
+}
+
 inline ErrCode ConfigClientConnectionImpl::dequeue(IPacket** packet)
 {
     OPENDAQ_PARAM_NOT_NULL(packet);
@@ -131,4 +140,18 @@ inline ErrCode ConfigClientConnectionImpl::isRemote(Bool* remote)
     return OPENDAQ_SUCCESS;
 }
 
+inline ErrCode ConfigClientConnectionImpl::dequeueAll(IList** packets)
+{
+    OPENDAQ_PARAM_NOT_NULL(packets);
+
+    return createListWithElementType(packets, IPacket::Id);
+}
+
+inline ErrCode ConfigClientConnectionImpl::dequeueUpTo(SizeT /*count*/, IList** packets)
+{
+    OPENDAQ_PARAM_NOT_NULL(packets);
+
+    return createListWithElementType(packets, IPacket::Id);
+}
+
 }
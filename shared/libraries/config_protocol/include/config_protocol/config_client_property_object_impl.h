@@ -146,7 +146,8 @@ ErrCode ConfigClientPropertyObjectBaseImpl<Impl>::setPropertyValue(IString* prop
         {
             checkCanSetPropertyValue(propertyNamePtr);
             const auto fullPropName = getFullPropName(propertyNamePtr);
-            clientComm->setPropertyValue(remoteGlobalId, fullPropName, valuePtr);
+            if (!clientComm->batchPropertyValue(remoteGlobalId, fullPropName, valuePtr))
+                clientComm->setPropertyValue(remoteGlobalId, fullPropName, valuePtr);
         });
 }
 
@@ -164,6 +165,8 @@ ErrCode ConfigClientPropertyObjectBaseImpl<Impl>::setProtectedPropertyValue(IStr
     {
         checkCanSetPropertyValue(propertyNamePtr);
         const auto fullPropName = getFullPropName(propertyNamePtr);
+        // values queued by an update are sent first, so the server applies the changes in order
+        clientComm->flushPropertyValueBatch(remoteGlobalId);
         clientComm->setProtectedPropertyValue(remoteGlobalId, fullPropName, valuePtr);
     });
 }
@@ -211,6 +214,7 @@ ErrCode ConfigClientPropertyObjectBaseImpl<Impl>::clearPropertyValue(IString* pr
     const auto propertyNamePtr = StringPtr::Borrow(propertyName);
     return daqTry([this, &propertyNamePtr]()
     {
+        clientComm->flushPropertyValueBatch(remoteGlobalId);
         clientComm->clearPropertyValue(remoteGlobalId, propertyNamePtr);
     });
 }
@@ -288,7 +292,10 @@ ErrCode INTERFACE_FUNC ConfigClientPropertyObjectBaseImpl<Impl>::beginUpdate()
 {
     return daqTry([this]()
         {
+            // the server update also holds back the values of child components; when the server supports batch
+            // requests, the values set on this component during the update are sent together with its end
             clientComm->sendComponentCommand(remoteGlobalId, "BeginUpdate");
+            clientComm->beginPropertyValueBatch(remoteGlobalId);
         });
 }
 
@@ -297,7 +304,8 @@ inline ErrCode INTERFACE_FUNC ConfigClientPropertyObjectBaseImpl<Impl>::endUpdat
 {
     return daqTry([this]()
         {
-            clientComm->sendComponentCommand(remoteGlobalId, "EndUpdate");
+            if (!clientComm->endPropertyValueBatch(remoteGlobalId))
+                clientComm->sendComponentCommand(remoteGlobalId, "EndUpdate");
         });
 }
 
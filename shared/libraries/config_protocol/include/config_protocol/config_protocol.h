@@ -39,6 +39,11 @@ inline auto ParamsDict(std::initializer_list<std::pair<const StringPtr, ObjectPt
 }
 
 
+// Highest protocol version known to this implementation; version 1 adds the SetPropertyValues and
+// GetPropertyValues batch requests
+constexpr uint16_t ConfigProtocolVersion = 1;
+constexpr uint16_t BatchRequestsConfigProtocolVersion = 1;
+
 enum PacketType: uint8_t
 {
     GetProtocolInfo = 0x80,
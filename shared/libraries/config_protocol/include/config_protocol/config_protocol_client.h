@@ -29,14 +29,28 @@
 #include <coreobjects/core_event_args_factory.h>
 
 #include "opendaq/custom_log.h"
+#include <opendaq/awaitable_ptr.h>
+#include <atomic>
+#include <future>
+#include <mutex>
+#include <map>
+#include <thread>
 
 namespace daq::config_protocol
 {
 
 using SendRequestCallback = std::function<PacketBuffer(PacketBuffer&)>;
+using SendRequestAsyncCallback = std::function<std::future<PacketBuffer>(PacketBuffer&)>;
 using ServerNotificationReceivedCallback = std::function<bool(const BaseObjectPtr& obj)>;
 using ComponentDeserializeCallback = std::function<ErrCode(ISerializedObject*, IBaseObject*, IFunction*, IBaseObject**)>;
 
+struct PropertyValueEntry
+{
+    std::string globalId;
+    std::string propertyName;
+    BaseObjectPtr propertyValue;
+};
+
 class ConfigProtocolClientComm : public std::enable_shared_from_this<ConfigProtocolClientComm>
 {
 public:
@@ -44,7 +58,8 @@ public:
     friend class ConfigProtocolClient;
     explicit ConfigProtocolClientComm(const ContextPtr& daqContext,
                                       SendRequestCallback sendRequestCallback,
-                                      ComponentDeserializeCallback rootDeviceDeserializeCallback);
+                                      ComponentDeserializeCallback rootDeviceDeserializeCallback,
+                                      SendRequestAsyncCallback sendRequestAsyncCallback = nullptr);
 
     void setPropertyValue(const std::string& globalId, const std::string& propertyName, const BaseObjectPtr& propertyValue);
     void setProtectedPropertyValue(const std::string& globalId, const std::string& propertyName, const BaseObjectPtr& propertyValue);
@@ -54,6 +69,30 @@ public:
     BaseObjectPtr callProperty(const std::string& globalId, const std::string& propertyName, const BaseObjectPtr& params);
     void setAttributeValue(const std::string& globalId, const std::string& attributeName, const BaseObjectPtr& attributeValue);
 
+    // batch variants send all entries in a single request when the server supports it and one request per entry
+    // otherwise; each entry is processed independently and the first failed entry is rethrown on the client.
+    // The values set on a component are applied in a single update. The property value of the entries is ignored
+    // when getting values
+    void setPropertyValues(const std::vector<PropertyValueEntry>& entries);
+    ListPtr<IBaseObject> getPropertyValues(const std::vector<PropertyValueEntry>& entries);
+
+    // async variants return as soon as the requests are sent and are completed by the replies, so several requests
+    // can be in flight at the same time. Without an asynchronous send callback the requests complete before returning
+    AwaitablePtr setPropertyValueAsync(const std::string& globalId, const std::string& propertyName, const BaseObjectPtr& propertyValue);
+    AwaitablePtr getPropertyValueAsync(const std::string& globalId, const std::string& propertyName);
+    AwaitablePtr setPropertyValuesAsync(const std::vector<PropertyValueEntry>& entries);
+    AwaitablePtr getPropertyValuesAsync(const std::vector<PropertyValueEntry>& entries);
+
+    // property values set on a component by the calling thread while its update is open are queued and sent in one
+    // SetPropertyValues request together with the end of the update. Values of other components are not queued.
+    // begin returns false when the server does not support batch requests; end returns false when it did not send
+    // the end of the update, which is then left to the caller
+    bool beginPropertyValueBatch(const std::string& globalId);
+    bool endPropertyValueBatch(const std::string& globalId);
+    bool batchPropertyValue(const std::string& globalId, const std::string& propertyName, const BaseObjectPtr& propertyValue);
+    void flushPropertyValueBatch(const std::string& globalId);
+
+    uint16_t getProtocolVersion() const;
     bool getConnected() const;
     ContextPtr getDaqContext();
 
@@ -80,14 +119,26 @@ public:
 
 private:
     ContextPtr daqContext;
-    uint64_t id;
+    std::atomic<uint64_t> id;
     SendRequestCallback sendRequestCallback;
+    SendRequestAsyncCallback sendRequestAsyncCallback;
     ComponentDeserializeCallback rootDeviceDeserializeCallback;
     SerializerPtr serializer;
+    std::mutex serializerSync;
     DeserializerPtr deserializer;
     bool connected;
+    uint16_t protocolVersion;
     WeakRefPtr<IDevice> rootDeviceRef;
 
+    struct PropertyValueBatch
+    {
+        size_t depth{0};
+        std::vector<PropertyValueEntry> entries;
+    };
+
+    std::map<std::pair<std::thread::id, std::string>, PropertyValueBatch> propertyValueBatches;
+    std::mutex propertyValueBatchesSync;
+
     ComponentDeserializeContextPtr createDeserializeContext(const std::string& remoteGlobalId,
                                                             const ContextPtr& context,
                                                             const ComponentPtr& root,
@@ -102,6 +153,15 @@ private:
                                             bool isGetRootDeviceReply = false);
     uint64_t generateId();
 
+    ListPtr<IDict> createPropertyValueEntries(const std::vector<PropertyValueEntry>& entries, bool withValues) const;
+    static ListPtr<IBaseObject> parseBatchReturnValue(const ListPtr<IBaseObject>& results);
+    bool supportsBatchRequests() const;
+    void sendPropertyValues(const std::vector<PropertyValueEntry>& entries, const std::string& endUpdateGlobalId);
+
+    std::future<PacketBuffer> sendRequestAsync(PacketBuffer& requestPacketBuffer);
+    AwaitablePtr createRequestAwaitable(std::vector<std::future<PacketBuffer>>&& replies,
+                                        std::function<BaseObjectPtr(ConfigProtocolClientComm&, std::vector<PacketBuffer>&)> parseReplies);
+
     BaseObjectPtr sendComponentCommandInternal(const StringPtr& command,
                                                const ParamsDictPtr& params,
                                                const ComponentPtr& parentComponent = nullptr,
@@ -129,9 +189,14 @@ public:
     // serverNotificationReceivedCallback is used by external code if for any reason needs to preprocess
     // server notification. it should return false when the notification should be handled by the ConfigProtocolClient
 
+    //
+    // sendRequestAsyncCallback is optional. It should send the packet and return a future that is completed with
+    // the reply packet, which lets the asynchronous requests of ConfigProtocolClientComm complete without blocking a thread
+
     explicit ConfigProtocolClient(const ContextPtr& daqContext,
                                   const SendRequestCallback& sendRequestCallback,
-                                  const ServerNotificationReceivedCallback& serverNotificationReceivedCallback);
+                                  const ServerNotificationReceivedCallback& serverNotificationReceivedCallback,
+                                  const SendRequestAsyncCallback& sendRequestAsyncCallback = nullptr);
 
     // called from client module
     DevicePtr connect(const ComponentPtr& parent = nullptr);
@@ -161,7 +226,10 @@ private:
 };
 
 template<class TRootDeviceImpl>
-ConfigProtocolClient<TRootDeviceImpl>::ConfigProtocolClient(const ContextPtr& daqContext, const SendRequestCallback& sendRequestCallback, const ServerNotificationReceivedCallback& serverNotificationReceivedCallback)
+ConfigProtocolClient<TRootDeviceImpl>::ConfigProtocolClient(const ContextPtr& daqContext,
+                                                            const SendRequestCallback& sendRequestCallback,
+                                                            const ServerNotificationReceivedCallback& serverNotificationReceivedCallback,
+                                                            const SendRequestAsyncCallback& sendRequestAsyncCallback)
     : daqContext(daqContext)
     , sendRequestCallback(sendRequestCallback)
     , serverNotificationReceivedCallback(serverNotificationReceivedCallback)
@@ -173,7 +241,8 @@ ConfigProtocolClient<TRootDeviceImpl>::ConfigProtocolClient(const ContextPtr& da
               [](ISerializedObject* serialized, IBaseObject* context, IFunction* factoryCallback, IBaseObject** obj)
               {
                   return TRootDeviceImpl::Deserialize(serialized, context, factoryCallback, obj);
-              }))
+              },
+              sendRequestAsyncCallback))
 {
 }
 
@@ -190,10 +259,21 @@ DevicePtr ConfigProtocolClient<TRootDeviceImpl>::connect(const ComponentPtr& par
     if (currentVersion != 0)
         throw ConfigProtocolException("Invalid server protocol version");
 
-    if (std::find(supportedVersions.begin(), supportedVersions.end(), 0) == supportedVersions.end())
+    // the highest version supported by both sides is used; version 0 is supported by every server
+    uint16_t version = 0;
+    bool versionZeroSupported = false;
+    for (const auto supportedVersion : supportedVersions)
+    {
+        if (supportedVersion == 0)
+            versionZeroSupported = true;
+        else if (supportedVersion <= ConfigProtocolVersion)
+            version = std::max(version, supportedVersion);
+    }
+
+    if (!versionZeroSupported)
         throw ConfigProtocolException("Protocol not supported on server");
 
-    auto upgradeProtocolRequestPacketBuffer = PacketBuffer::createUpgradeProtocolRequest(clientComm->generateId(), 0);
+    auto upgradeProtocolRequestPacketBuffer = PacketBuffer::createUpgradeProtocolRequest(clientComm->generateId(), version);
     const auto upgradeProtocolReplyPacketBuffer = sendRequestCallback(upgradeProtocolRequestPacketBuffer);
 
     bool success;
@@ -202,6 +282,8 @@ DevicePtr ConfigProtocolClient<TRootDeviceImpl>::connect(const ComponentPtr& par
     if (!success)
         throw ConfigProtocolException("Protocol upgrade failed");
 
+    clientComm->protocolVersion = version;
+
     const auto localTypeManager = daqContext.getTypeManager();
     const TypeManagerPtr typeManager = clientComm->sendCommand("GetTypeManager");
     const auto types = typeManager.getTypes();
@@ -77,6 +77,7 @@ private:
     std::unordered_map<std::string, DispatchFunction> rpcDispatch;
     std::mutex notificationSerializerLock;
     std::unique_ptr<IComponentFinder> componentFinder;
+    uint16_t protocolVersion;
 
     PacketBuffer processPacket(const PacketBuffer& packetBuffer);
     StringPtr processRpc(const StringPtr& jsonStr);
@@ -86,6 +87,8 @@ private:
 
     BaseObjectPtr getComponent(const ParamsDictPtr& params) const;
     BaseObjectPtr getTypeManager(const ParamsDictPtr& params) const;
+    BaseObjectPtr callRpcForEach(const std::string& name, const ParamsDictPtr& params);
+    BaseObjectPtr setPropertyValues(const ParamsDictPtr& params);
 
     template <class SmartPtr, class F>
     BaseObjectPtr bindComponentWrapper(const F& f, const ParamsDictPtr& params);
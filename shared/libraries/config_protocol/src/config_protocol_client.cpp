@@ -7,20 +7,122 @@
 #include <config_protocol/config_client_device_impl.h>
 #include <config_protocol/config_client_channel_impl.h>
 #include <config_protocol/config_protocol_deserialize_context_impl.h>
+#include <opendaq/awaitable.h>
+#include <coretypes/impl.h>
+#include <algorithm>
 
 namespace daq::config_protocol
 {
 
+namespace
+{
+
+// Completed by the replies of requests that were already sent, so waiting is left to the caller
+class ConfigClientRequestAwaitableImpl : public ImplementationOf<IAwaitable>
+{
+public:
+    using ParseRepliesCallback = std::function<BaseObjectPtr(std::vector<PacketBuffer>&)>;
+
+    ConfigClientRequestAwaitableImpl(std::vector<std::future<PacketBuffer>>&& replyFutures, ParseRepliesCallback parseReplies)
+        : replyFutures(std::move(replyFutures))
+        , parseReplies(std::move(parseReplies))
+        , completed(false)
+    {
+    }
+
+    ErrCode INTERFACE_FUNC cancel(Bool* canceled) override
+    {
+        OPENDAQ_PARAM_NOT_NULL(canceled);
+
+        // the requests are sent on creation and cannot be recalled
+        *canceled = False;
+        return OPENDAQ_SUCCESS;
+    }
+
+    ErrCode INTERFACE_FUNC wait() override
+    {
+        std::scoped_lock lock(sync);
+        if (completed)
+            return OPENDAQ_IGNORED;
+
+        complete();
+        return OPENDAQ_SUCCESS;
+    }
+
+    ErrCode INTERFACE_FUNC getResult(IBaseObject** result) override
+    {
+        OPENDAQ_PARAM_NOT_NULL(result);
+
+        std::scoped_lock lock(sync);
+        if (!completed)
+            complete();
+
+        return daqTry([this, &result]()
+        {
+            if (error)
+                std::rethrow_exception(error);
+
+            *result = value.addRefAndReturn();
+        });
+    }
+
+    ErrCode INTERFACE_FUNC hasCompleted(Bool* finished) override
+    {
+        OPENDAQ_PARAM_NOT_NULL(finished);
+
+        std::scoped_lock lock(sync);
+        *finished = completed || std::all_of(replyFutures.begin(),
+                                             replyFutures.end(),
+                                             [](const std::future<PacketBuffer>& future)
+                                             {
+                                                 return future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+                                             });
+        return OPENDAQ_SUCCESS;
+    }
+
+private:
+    void complete()
+    {
+        try
+        {
+            std::vector<PacketBuffer> replies;
+            replies.reserve(replyFutures.size());
+            for (auto& future : replyFutures)
+                replies.push_back(future.get());
+
+            value = parseReplies(replies);
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+
+        completed = true;
+    }
+
+    std::vector<std::future<PacketBuffer>> replyFutures;
+    ParseRepliesCallback parseReplies;
+    std::mutex sync;
+    bool completed;
+    BaseObjectPtr value;
+    std::exception_ptr error;
+};
+
+}
+
 ConfigProtocolClientComm::ConfigProtocolClientComm(const ContextPtr& daqContext,
                                                    SendRequestCallback sendRequestCallback,
-                                                   ComponentDeserializeCallback rootDeviceDeserializeCallback)
+                                                   ComponentDeserializeCallback rootDeviceDeserializeCallback,
+                                                   SendRequestAsyncCallback sendRequestAsyncCallback)
         : daqContext(daqContext)
         , id(0)
         , sendRequestCallback(std::move(sendRequestCallback))
+        , sendRequestAsyncCallback(std::move(sendRequestAsyncCallback))
         , rootDeviceDeserializeCallback(std::move(rootDeviceDeserializeCallback))
         , serializer(JsonSerializer())
         , deserializer(JsonDeserializer())
         , connected(false)
+        , protocolVersion(0)
 {
 }
 
@@ -131,6 +233,349 @@ void ConfigProtocolClientComm::setAttributeValue(const std::string& globalId,
     parseRpcReplyPacketBuffer(setAttributeValueRpcReplyPacketBuffer);
 }
 
+void ConfigProtocolClientComm::setPropertyValues(const std::vector<PropertyValueEntry>& entries)
+{
+    if (entries.empty())
+        return;
+
+    if (!supportsBatchRequests())
+    {
+        std::exception_ptr firstError;
+        for (const auto& entry : entries)
+        {
+            try
+            {
+                setPropertyValue(entry.globalId, entry.propertyName, entry.propertyValue);
+            }
+            catch (...)
+            {
+                if (!firstError)
+                    firstError = std::current_exception();
+            }
+        }
+
+        if (firstError)
+            std::rethrow_exception(firstError);
+        return;
+    }
+
+    sendPropertyValues(entries, std::string{});
+}
+
+void ConfigProtocolClientComm::sendPropertyValues(const std::vector<PropertyValueEntry>& entries, const std::string& endUpdateGlobalId)
+{
+    auto dict = Dict<IString, IBaseObject>();
+    dict.set("Properties", createPropertyValueEntries(entries, true));
+    if (!endUpdateGlobalId.empty())
+        dict.set("EndUpdateComponentGlobalId", String(endUpdateGlobalId));
+    auto setPropertyValuesRpcRequestPacketBuffer = createRpcRequestPacketBuffer(generateId(), "SetPropertyValues", dict);
+    const auto setPropertyValuesRpcReplyPacketBuffer = sendRequestCallback(setPropertyValuesRpcRequestPacketBuffer);
+
+    const ListPtr<IBaseObject> results = parseRpcReplyPacketBuffer(setPropertyValuesRpcReplyPacketBuffer);
+    // ReSharper disable once CppExpressionWithoutSideEffects
+    parseBatchReturnValue(results);
+}
+
+ListPtr<IBaseObject> ConfigProtocolClientComm::getPropertyValues(const std::vector<PropertyValueEntry>& entries)
+{
+    if (!supportsBatchRequests())
+    {
+        auto values = List<IBaseObject>();
+        for (const auto& entry : entries)
+            values.pushBack(getPropertyValue(entry.globalId, entry.propertyName));
+        return values;
+    }
+
+    auto dict = Dict<IString, IBaseObject>();
+    dict.set("Properties", createPropertyValueEntries(entries, false));
+    auto getPropertyValuesRpcRequestPacketBuffer = createRpcRequestPacketBuffer(generateId(), "GetPropertyValues", dict);
+    const auto getPropertyValuesRpcReplyPacketBuffer = sendRequestCallback(getPropertyValuesRpcRequestPacketBuffer);
+
+    const auto deserializeContext = createDeserializeContext(std::string{}, daqContext, nullptr, nullptr, nullptr, nullptr);
+
+    const ListPtr<IBaseObject> results = parseRpcReplyPacketBuffer(getPropertyValuesRpcReplyPacketBuffer, deserializeContext);
+    return parseBatchReturnValue(results);
+}
+
+AwaitablePtr ConfigProtocolClientComm::setPropertyValueAsync(const std::string& globalId,
+                                                             const std::string& propertyName,
+                                                             const BaseObjectPtr& propertyValue)
+{
+    auto dict = Dict<IString, IBaseObject>();
+    dict.set("ComponentGlobalId", String(globalId));
+    dict.set("PropertyName", String(propertyName));
+    dict.set("PropertyValue", propertyValue);
+    auto setPropertyValueRpcRequestPacketBuffer = createRpcRequestPacketBuffer(generateId(), "SetPropertyValue", dict);
+
+    std::vector<std::future<PacketBuffer>> replies;
+    replies.push_back(sendRequestAsync(setPropertyValueRpcRequestPacketBuffer));
+    return createRequestAwaitable(std::move(replies),
+                                  [](ConfigProtocolClientComm& comm, std::vector<PacketBuffer>& replyPackets) -> BaseObjectPtr
+                                  {
+                                      // ReSharper disable once CppExpressionWithoutSideEffects
+                                      comm.parseRpcReplyPacketBuffer(replyPackets[0]);
+                                      return nullptr;
+                                  });
+}
+
+AwaitablePtr ConfigProtocolClientComm::getPropertyValueAsync(const std::string& globalId, const std::string& propertyName)
+{
+    auto dict = Dict<IString, IBaseObject>();
+    dict.set("ComponentGlobalId", String(globalId));
+    dict.set("PropertyName", String(propertyName));
+    auto getPropertyValueRpcRequestPacketBuffer = createRpcRequestPacketBuffer(generateId(), "GetPropertyValue", dict);
+
+    std::vector<std::future<PacketBuffer>> replies;
+    replies.push_back(sendRequestAsync(getPropertyValueRpcRequestPacketBuffer));
+    return createRequestAwaitable(std::move(replies),
+                                  [](ConfigProtocolClientComm& comm, std::vector<PacketBuffer>& replyPackets) -> BaseObjectPtr
+                                  {
+                                      const auto deserializeContext =
+                                          comm.createDeserializeContext(std::string{}, comm.daqContext, nullptr, nullptr, nullptr, nullptr);
+                                      return comm.parseRpcReplyPacketBuffer(replyPackets[0], deserializeContext);
+                                  });
+}
+
+AwaitablePtr ConfigProtocolClientComm::setPropertyValuesAsync(const std::vector<PropertyValueEntry>& entries)
+{
+    std::vector<std::future<PacketBuffer>> replies;
+
+    if (!supportsBatchRequests())
+    {
+        // the requests of the entries are pipelined and their failures are collected once all replies arrive
+        for (const auto& entry : entries)
+        {
+            auto dict = Dict<IString, IBaseObject>();
+            dict.set("ComponentGlobalId", String(entry.globalId));
+            dict.set("PropertyName", String(entry.propertyName));
+            dict.set("PropertyValue", entry.propertyValue);
+            auto setPropertyValueRpcRequestPacketBuffer = createRpcRequestPacketBuffer(generateId(), "SetPropertyValue", dict);
+            replies.push_back(sendRequestAsync(setPropertyValueRpcRequestPacketBuffer));
+        }
+
+        return createRequestAwaitable(std::move(replies),
+                                      [](ConfigProtocolClientComm& comm, std::vector<PacketBuffer>& replyPackets) -> BaseObjectPtr
+                                      {
+                                          std::exception_ptr firstError;
+                                          for (const auto& reply : replyPackets)
+                                          {
+                                              try
+                                              {
+                                                  // ReSharper disable once CppExpressionWithoutSideEffects
+                                                  comm.parseRpcReplyPacketBuffer(reply);
+                                              }
+                                              catch (...)
+                                              {
+                                                  if (!firstError)
+                                                      firstError = std::current_exception();
+                                              }
+                                          }
+
+                                          if (firstError)
+                                              std::rethrow_exception(firstError);
+                                          return nullptr;
+                                      });
+    }
+
+    auto dict = Dict<IString, IBaseObject>();
+    dict.set("Properties", createPropertyValueEntries(entries, true));
+    auto setPropertyValuesRpcRequestPacketBuffer = createRpcRequestPacketBuffer(generateId(), "SetPropertyValues", dict);
+    replies.push_back(sendRequestAsync(setPropertyValuesRpcRequestPacketBuffer));
+
+    return createRequestAwaitable(std::move(replies),
+                                  [](ConfigProtocolClientComm& comm, std::vector<PacketBuffer>& replyPackets) -> BaseObjectPtr
+                                  {
+                                      const ListPtr<IBaseObject> results = comm.parseRpcReplyPacketBuffer(replyPackets[0]);
+                                      // ReSharper disable once CppExpressionWithoutSideEffects
+                                      parseBatchReturnValue(results);
+                                      return nullptr;
+                                  });
+}
+
+AwaitablePtr ConfigProtocolClientComm::getPropertyValuesAsync(const std::vector<PropertyValueEntry>& entries)
+{
+    std::vector<std::future<PacketBuffer>> replies;
+
+    if (!supportsBatchRequests())
+    {
+        for (const auto& entry : entries)
+        {
+            auto dict = Dict<IString, IBaseObject>();
+            dict.set("ComponentGlobalId", String(entry.globalId));
+            dict.set("PropertyName", String(entry.propertyName));
+            auto getPropertyValueRpcRequestPacketBuffer = createRpcRequestPacketBuffer(generateId(), "GetPropertyValue", dict);
+            replies.push_back(sendRequestAsync(getPropertyValueRpcRequestPacketBuffer));
+        }
+
+        return createRequestAwaitable(std::move(replies),
+                                      [](ConfigProtocolClientComm& comm, std::vector<PacketBuffer>& replyPackets) -> BaseObjectPtr
+                                      {
+                                          const auto deserializeContext =
+                                              comm.createDeserializeContext(std::string{}, comm.daqContext, nullptr, nullptr, nullptr, nullptr);
+
+                                          auto values = List<IBaseObject>();
+                                          for (const auto& reply : replyPackets)
+                                              values.pushBack(comm.parseRpcReplyPacketBuffer(reply, deserializeContext));
+                                          return values;
+                                      });
+    }
+
+    auto dict = Dict<IString, IBaseObject>();
+    dict.set("Properties", createPropertyValueEntries(entries, false));
+    auto getPropertyValuesRpcRequestPacketBuffer = createRpcRequestPacketBuffer(generateId(), "GetPropertyValues", dict);
+    replies.push_back(sendRequestAsync(getPropertyValuesRpcRequestPacketBuffer));
+
+    return createRequestAwaitable(std::move(replies),
+                                  [](ConfigProtocolClientComm& comm, std::vector<PacketBuffer>& replyPackets) -> BaseObjectPtr
+                                  {
+                                      const auto deserializeContext =
+                                          comm.createDeserializeContext(std::string{}, comm.daqContext, nullptr, nullptr, nullptr, nullptr);
+
+                                      const ListPtr<IBaseObject> results = comm.parseRpcReplyPacketBuffer(replyPackets[0], deserializeContext);
+                                      return parseBatchReturnValue(results);
+                                  });
+}
+
+bool ConfigProtocolClientComm::beginPropertyValueBatch(const std::string& globalId)
+{
+    if (!supportsBatchRequests())
+        return false;
+
+    std::scoped_lock lock(propertyValueBatchesSync);
+    propertyValueBatches[{std::this_thread::get_id(), globalId}].depth++;
+    return true;
+}
+
+bool ConfigProtocolClientComm::endPropertyValueBatch(const std::string& globalId)
+{
+    std::vector<PropertyValueEntry> entries;
+    {
+        std::scoped_lock lock(propertyValueBatchesSync);
+        const auto it = propertyValueBatches.find({std::this_thread::get_id(), globalId});
+        if (it == propertyValueBatches.end())
+            return false;
+
+        std::swap(entries, it->second.entries);
+        if (--it->second.depth == 0)
+            propertyValueBatches.erase(it);
+    }
+
+    if (entries.empty())
+        return false;
+
+    sendPropertyValues(entries, globalId);
+    return true;
+}
+
+bool ConfigProtocolClientComm::batchPropertyValue(const std::string& globalId,
+                                                  const std::string& propertyName,
+                                                  const BaseObjectPtr& propertyValue)
+{
+    std::scoped_lock lock(propertyValueBatchesSync);
+    const auto it = propertyValueBatches.find({std::this_thread::get_id(), globalId});
+    if (it == propertyValueBatches.end())
+        return false;
+
+    it->second.entries.push_back({globalId, propertyName, propertyValue});
+    return true;
+}
+
+void ConfigProtocolClientComm::flushPropertyValueBatch(const std::string& globalId)
+{
+    std::vector<PropertyValueEntry> entries;
+    {
+        std::scoped_lock lock(propertyValueBatchesSync);
+        const auto it = propertyValueBatches.find({std::this_thread::get_id(), globalId});
+        if (it == propertyValueBatches.end())
+            return;
+
+        std::swap(entries, it->second.entries);
+    }
+
+    setPropertyValues(entries);
+}
+
+uint16_t ConfigProtocolClientComm::getProtocolVersion() const
+{
+    return protocolVersion;
+}
+
+bool ConfigProtocolClientComm::supportsBatchRequests() const
+{
+    return protocolVersion >= BatchRequestsConfigProtocolVersion;
+}
+
+std::future<PacketBuffer> ConfigProtocolClientComm::sendRequestAsync(PacketBuffer& requestPacketBuffer)
+{
+    if (sendRequestAsyncCallback)
+        return sendRequestAsyncCallback(requestPacketBuffer);
+
+    // without an asynchronous transport the request is completed before returning
+    std::promise<PacketBuffer> reply;
+    try
+    {
+        reply.set_value(sendRequestCallback(requestPacketBuffer));
+    }
+    catch (...)
+    {
+        reply.set_exception(std::current_exception());
+    }
+
+    return reply.get_future();
+}
+
+AwaitablePtr ConfigProtocolClientComm::createRequestAwaitable(
+    std::vector<std::future<PacketBuffer>>&& replies,
+    std::function<BaseObjectPtr(ConfigProtocolClientComm&, std::vector<PacketBuffer>&)> parseReplies)
+{
+    return createWithImplementation<IAwaitable, ConfigClientRequestAwaitableImpl>(
+        std::move(replies),
+        [weakComm = weak_from_this(), parseReplies = std::move(parseReplies)](std::vector<PacketBuffer>& replyPackets) -> BaseObjectPtr
+        {
+            const auto comm = weakComm.lock();
+            if (!comm)
+                throw InvalidStateException("Configuration protocol client was destroyed");
+
+            return parseReplies(*comm, replyPackets);
+        });
+}
+
+ListPtr<IDict> ConfigProtocolClientComm::createPropertyValueEntries(const std::vector<PropertyValueEntry>& entries, bool withValues) const
+{
+    auto list = List<IDict>();
+    for (const auto& entry : entries)
+    {
+        auto dict = Dict<IString, IBaseObject>();
+        dict.set("ComponentGlobalId", String(entry.globalId));
+        dict.set("PropertyName", String(entry.propertyName));
+        if (withValues)
+            dict.set("PropertyValue", entry.propertyValue);
+        list.pushBack(dict);
+    }
+
+    return list;
+}
+
+ListPtr<IBaseObject> ConfigProtocolClientComm::parseBatchReturnValue(const ListPtr<IBaseObject>& results)
+{
+    auto values = List<IBaseObject>();
+    for (const ParamsDictPtr result : results)
+    {
+        const ErrCode errCode = result["ErrorCode"];
+        if (OPENDAQ_FAILED(errCode))
+        {
+            std::string msg;
+            if (result.hasKey("ErrorMessage"))
+                msg = static_cast<std::string>(result.get("ErrorMessage"));
+            throwExceptionFromErrorCode(errCode, msg);
+        }
+
+        values.pushBack(result.hasKey("ReturnValue") ? result.get("ReturnValue") : nullptr);
+    }
+
+    return values;
+}
+
 BaseObjectPtr ConfigProtocolClientComm::createRpcRequest(const StringPtr& name, const ParamsDictPtr& params) const
 {
     auto obj = Dict<IString, IBaseObject>();
@@ -144,6 +589,8 @@ BaseObjectPtr ConfigProtocolClientComm::createRpcRequest(const StringPtr& name,
 StringPtr ConfigProtocolClientComm::createRpcRequestJson(const StringPtr& name, const ParamsDictPtr& params)
 {
     const auto obj = createRpcRequest(name, params);
+
+    std::scoped_lock lock(serializerSync);
     serializer.reset();
     obj.serialize(serializer);
     return serializer.getOutput();
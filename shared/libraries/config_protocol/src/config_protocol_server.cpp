@@ -6,6 +6,7 @@
 #include <config_protocol/config_server_input_port.h>
 #include <coreobjects/core_event_args_factory.h>
 #include <coretypes/cloneable.h>
+#include <algorithm>
 
 namespace daq::config_protocol
 {
@@ -71,6 +72,7 @@ ConfigProtocolServer::ConfigProtocolServer(DevicePtr rootDevice,
     , serializer(JsonSerializer())
     , notificationSerializer(JsonSerializer())
     , componentFinder(std::make_unique<ComponentFinderRootDevice>(this->rootDevice))
+    , protocolVersion(0)
 {
     buildRpcDispatchStructure();
 
@@ -137,6 +139,9 @@ void ConfigProtocolServer::buildRpcDispatchStructure()
     addHandler<ComponentPtr>("SetAttributeValue", &ConfigServerComponent::setAttributeValue);
     addHandler<ComponentPtr>("Update", &ConfigServerComponent::update);
 
+    rpcDispatch.insert({"SetPropertyValues", std::bind(&ConfigProtocolServer::setPropertyValues, this, _1)});
+    rpcDispatch.insert({"GetPropertyValues", std::bind(&ConfigProtocolServer::callRpcForEach, this, "GetPropertyValue", _1)});
+
     addHandler<DevicePtr>("GetInfo", &ConfigServerDevice::getInfo);
     addHandler<DevicePtr>("GetAvailableFunctionBlockTypes", &ConfigServerDevice::getAvailableFunctionBlockTypes);
     addHandler<DevicePtr>("AddFunctionBlock", &ConfigServerDevice::addFunctionBlock);
@@ -210,14 +215,17 @@ PacketBuffer ConfigProtocolServer::processPacket(const PacketBuffer& packetBuffe
         case PacketType::GetProtocolInfo:
             {
                 packetBuffer.parseProtocolInfoRequest();
-                auto reply = PacketBuffer::createGetProtocolInfoReply(requestId, 0, {0});
+                auto reply = PacketBuffer::createGetProtocolInfoReply(requestId, protocolVersion, {0, ConfigProtocolVersion});
                 return reply;
             }
         case PacketType::UpgradeProtocol:
             {
                 uint16_t version;
                 packetBuffer.parseProtocolUpgradeRequest(version);
-                auto reply = PacketBuffer::createUpgradeProtocolReply(requestId, version == 0);
+                const bool success = version <= ConfigProtocolVersion;
+                if (success)
+                    protocolVersion = version;
+                auto reply = PacketBuffer::createUpgradeProtocolReply(requestId, success);
                 return reply;
             }
         case PacketType::Rpc:
@@ -281,6 +289,117 @@ BaseObjectPtr ConfigProtocolServer::callRpc(const StringPtr& name, const ParamsD
     return it->second(params);
 }
 
+BaseObjectPtr ConfigProtocolServer::callRpcForEach(const std::string& name, const ParamsDictPtr& params)
+{
+    if (protocolVersion < BatchRequestsConfigProtocolVersion)
+        throw ConfigProtocolException("Batch requests are not supported by the negotiated protocol version");
+
+    const ListPtr<IBaseObject> properties = params.get("Properties");
+
+    auto results = List<IBaseObject>();
+    for (const ParamsDictPtr property : properties)
+    {
+        auto result = Dict<IString, IBaseObject>();
+        try
+        {
+            const auto retValue = callRpc(String(name), property);
+
+            result.set("ErrorCode", OPENDAQ_SUCCESS);
+            if (retValue.assigned())
+                result.set("ReturnValue", retValue);
+        }
+        catch (const daq::DaqException& e)
+        {
+            result.set("ErrorCode", e.getErrCode());
+            result.set("ErrorMessage", e.what());
+        }
+        catch (const std::exception& e)
+        {
+            result.set("ErrorCode", OPENDAQ_ERR_GENERALERROR);
+            result.set("ErrorMessage", e.what());
+        }
+
+        results.pushBack(result);
+    }
+
+    return results;
+}
+
+BaseObjectPtr ConfigProtocolServer::setPropertyValues(const ParamsDictPtr& params)
+{
+    if (protocolVersion < BatchRequestsConfigProtocolVersion)
+        throw ConfigProtocolException("Batch requests are not supported by the negotiated protocol version");
+
+    const ListPtr<IBaseObject> properties = params.get("Properties");
+
+    // The values of each component are applied together, as if they were set between beginUpdate and endUpdate
+    std::vector<std::string> componentIds;
+    for (const ParamsDictPtr property : properties)
+    {
+        const auto componentId = static_cast<std::string>(property.get("ComponentGlobalId"));
+        if (std::find(componentIds.begin(), componentIds.end(), componentId) == componentIds.end())
+            componentIds.push_back(componentId);
+    }
+
+    std::vector<std::string> updatingIds;
+    for (const auto& componentId : componentIds)
+    {
+        try
+        {
+            callRpc("BeginUpdate", ParamsDict({{"ComponentGlobalId", String(componentId)}}));
+            updatingIds.push_back(componentId);
+        }
+        catch (const std::exception&)
+        {
+            // the entries of a component that cannot be updated report the error themselves
+        }
+    }
+
+    const ListPtr<IBaseObject> results = callRpcForEach("SetPropertyValue", params);
+
+    for (const auto& componentId : updatingIds)
+    {
+        ErrCode errCode = OPENDAQ_SUCCESS;
+        std::string errMessage;
+        try
+        {
+            callRpc("EndUpdate", ParamsDict({{"ComponentGlobalId", String(componentId)}}));
+        }
+        catch (const daq::DaqException& e)
+        {
+            errCode = e.getErrCode();
+            errMessage = e.what();
+        }
+        catch (const std::exception& e)
+        {
+            errCode = OPENDAQ_ERR_GENERALERROR;
+            errMessage = e.what();
+        }
+
+        if (OPENDAQ_SUCCEEDED(errCode))
+            continue;
+
+        // accepted values are applied by endUpdate, so its failure is reported for each of them
+        for (SizeT i = 0; i < properties.getCount(); ++i)
+        {
+            const ParamsDictPtr property = properties[i];
+            const ParamsDictPtr result = results[i];
+            const ErrCode entryErrCode = result.get("ErrorCode");
+            if (static_cast<std::string>(property.get("ComponentGlobalId")) == componentId && OPENDAQ_SUCCEEDED(entryErrCode))
+            {
+                result.set("ErrorCode", errCode);
+                result.set("ErrorMessage", String(errMessage));
+            }
+        }
+    }
+
+    // the client folds the end of its own update of a component into the request that carries the values set during it
+    if (params.hasKey("EndUpdateComponentGlobalId"))
+        callRpc("EndUpdate", ParamsDict({{"ComponentGlobalId", params.get("EndUpdateComponentGlobalId")}}));
+
+    return results;
+}
+
 ComponentPtr ConfigProtocolServer::findComponent(const std::string& componentGlobalId) const
 {
     ComponentPtr component;
@@ -15,6 +15,8 @@
 #include <opendaq/function_block_impl.h>
 #include <opendaq/component_holder_ptr.h>
 #include <config_protocol/config_client_device_impl.h>
+#include <opendaq/awaitable_ptr.h>
+#include <future>
 
 using namespace daq;
 using namespace config_protocol;
@@ -190,6 +192,93 @@ TEST_F(ConfigProtocolTest, SetChildObjectPropertyValue)
     ASSERT_EQ(device->getPropertyValue("PropName.StringProp"), "val");
 }
 
+TEST_F(ConfigProtocolTest, SetPropertyValuesRoot)
+{
+    device->addProperty(StringPropertyBuilder("StringProp", "-").build());
+    device->addProperty(IntPropertyBuilder("IntProp", 0).build());
+
+    client->getClientComm()->setPropertyValues({{"//root", "StringProp", "val"}, {"//root", "IntProp", 5}});
+
+    ASSERT_EQ(device->getPropertyValue("StringProp"), "val");
+    ASSERT_EQ(device->getPropertyValue("IntProp"), 5);
+}
+
+TEST_F(ConfigProtocolTest, SetPropertyValuesPartialFailure)
+{
+    device->addProperty(StringPropertyBuilder("StringProp", "-").build());
+
+    ASSERT_THROW(client->getClientComm()->setPropertyValues({{"//root", "Missing", "val"}, {"//root", "StringProp", "val"}}),
+                 NotFoundException);
+
+    ASSERT_EQ(device->getPropertyValue("StringProp"), "val");
+}
+
+TEST_F(ConfigProtocolTest, GetPropertyValuesRoot)
+{
+    device->addProperty(StringPropertyBuilder("StringProp", "val").build());
+    device->addProperty(IntPropertyBuilder("IntProp", 5).build());
+
+    const auto values = client->getClientComm()->getPropertyValues({{"//root", "StringProp", nullptr}, {"//root", "IntProp", nullptr}});
+
+    ASSERT_EQ(values.getCount(), 2u);
+    ASSERT_EQ(values[0], "val");
+    ASSERT_EQ(values[1], 5);
+}
+
+TEST_F(ConfigProtocolTest, PropertyValueAsync)
+{
+    device->addProperty(StringPropertyBuilder("StringProp", "-").build());
+
+    // replies are delivered by the test, as a transport would do once they are received
+    std::vector<std::pair<PacketBuffer, std::promise<PacketBuffer>>> pendingRequests;
+    SendRequestAsyncCallback sendRequestAsync = [&pendingRequests](const PacketBuffer& requestPacket)
+    {
+        auto& pendingRequest = pendingRequests.emplace_back(PacketBuffer(requestPacket.getBuffer(), true), std::promise<PacketBuffer>());
+        return pendingRequest.second.get_future();
+    };
+
+    ConfigProtocolClient<ConfigClientDeviceImpl> asyncClient(
+        NullContext(), std::bind(&ConfigProtocolTest::sendRequest, this, std::placeholders::_1), nullptr, sendRequestAsync);
+    const auto clientComm = asyncClient.getClientComm();
+
+    const auto setAwaitable = clientComm->setPropertyValueAsync("//root", "StringProp", "val");
+    const auto getAwaitable = clientComm->getPropertyValueAsync("//root", "StringProp");
+    const auto failedAwaitable = clientComm->getPropertyValueAsync("//root", "Missing");
+
+    ASSERT_EQ(pendingRequests.size(), 3u);
+    ASSERT_FALSE(setAwaitable.hasCompleted());
+    ASSERT_FALSE(getAwaitable.hasCompleted());
+    ASSERT_EQ(device->getPropertyValue("StringProp"), "-");
+
+    for (auto& [requestPacket, reply] : pendingRequests)
+        reply.set_value(sendRequest(requestPacket));
+
+    ASSERT_TRUE(setAwaitable.hasCompleted());
+    setAwaitable.wait();
+    ASSERT_EQ(getAwaitable.getResult(), "val");
+    ASSERT_THROW(failedAwaitable.getResult(), NotFoundException);
+}
+
+TEST_F(ConfigProtocolTest, PropertyValueAsyncWithoutAsyncCallback)
+{
+    device->addProperty(StringPropertyBuilder("StringProp", "val").build());
+
+    const auto awaitable = client->getClientComm()->getPropertyValueAsync("//root", "StringProp");
+
+    ASSERT_TRUE(awaitable.hasCompleted());
+    ASSERT_EQ(awaitable.getResult(), "val");
+}
+
+TEST_F(ConfigProtocolTest, PropertyValueBatchRequiresProtocolVersion)
+{
+    device->addProperty(StringPropertyBuilder("StringProp", "-").build());
+
+    // the client is not connected, so it talks the initial protocol version and falls back to one request per entry
+    ASSERT_EQ(client->getClientComm()->getProtocolVersion(), 0u);
+    ASSERT_FALSE(client->getClientComm()->beginPropertyValueBatch("//root"));
+    ASSERT_FALSE(client->getClientComm()->batchPropertyValue("//root", "StringProp", "val"));
+}
+
 TEST_F(ConfigProtocolTest, CallProcedurePropertyOneParam)
 {
     Int p1 = 0;
@@ -41,8 +41,9 @@ public:
         return str;
     }
     
-    PacketBuffer sendRequest(const PacketBuffer& requestPacket) const
+    PacketBuffer sendRequest(const PacketBuffer& requestPacket)
     {
+        requestCount++;
         auto replyPacket = server->processRequestAndGetReply(requestPacket);
         return replyPacket;
     }
@@ -59,6 +60,7 @@ protected:
     std::unique_ptr<ConfigProtocolClient<ConfigClientDeviceImpl>> client;
     ContextPtr clientContext;
     BaseObjectPtr notificationObj;
+    size_t requestCount{0};
 
 };
 
@@ -402,6 +404,72 @@ TEST_F(ConfigProtocolIntegrationTest, BeginEndUpdateRecursive)
     ASSERT_EQ(serverDevice.getChannels()[0].getPropertyValue("StrProp"), "SomeValue");
 }
 
+TEST_F(ConfigProtocolIntegrationTest, BeginEndUpdateSingleRequest)
+{
+    clientDevice.beginUpdate();
+    clientDevice.setPropertyValue("StrProp", "FirstValue");
+    clientDevice.setPropertyValue("StrProp", "SomeValue");
+
+    const auto requestCountBeforeEnd = requestCount;
+    clientDevice.endUpdate();
+
+    ASSERT_EQ(requestCount - requestCountBeforeEnd, 1u);
+    ASSERT_EQ(serverDevice.getPropertyValue("StrProp"), "SomeValue");
+    ASSERT_EQ(clientDevice.getPropertyValue("StrProp"), "SomeValue");
+}
+
+TEST_F(ConfigProtocolIntegrationTest, BeginUpdateDoesNotBatchOtherObjects)
+{
+    const auto clientChannel = clientDevice.getChannels()[0];
+    clientChannel.beginUpdate();
+    clientChannel.setPropertyValue("StrProp", "ChannelValue");
+
+    // the device has no open update, so its value is sent right away
+    const auto requestCountBeforeSet = requestCount;
+    clientDevice.setPropertyValue("StrProp", "DeviceValue");
+    ASSERT_EQ(requestCount - requestCountBeforeSet, 1u);
+    ASSERT_EQ(serverDevice.getPropertyValue("StrProp"), "DeviceValue");
+    ASSERT_EQ(serverDevice.getChannels()[0].getPropertyValue("StrProp"), "-");
+
+    clientChannel.endUpdate();
+    ASSERT_EQ(serverDevice.getChannels()[0].getPropertyValue("StrProp"), "ChannelValue");
+    ASSERT_EQ(clientChannel.getPropertyValue("StrProp"), "ChannelValue");
+}
+
+TEST_F(ConfigProtocolIntegrationTest, NegotiatedProtocolVersion)
+{
+    ASSERT_EQ(client->getClientComm()->getProtocolVersion(), ConfigProtocolVersion);
+}
+
+TEST_F(ConfigProtocolIntegrationTest, SetGetPropertyValuesBatch)
+{
+    const std::string deviceId = serverDevice.getGlobalId();
+    const std::string channelId = serverDevice.getChannels()[0].getGlobalId();
+    const auto clientComm = client->getClientComm();
+
+    const auto requestCountBeforeSet = requestCount;
+    clientComm->setPropertyValues({{deviceId, "StrProp", "DeviceValue"}, {channelId, "StrProp", "ChannelValue"}});
+    ASSERT_EQ(requestCount - requestCountBeforeSet, 1u);
+
+    ASSERT_EQ(serverDevice.getPropertyValue("StrProp"), "DeviceValue");
+    ASSERT_EQ(serverDevice.getChannels()[0].getPropertyValue("StrProp"), "ChannelValue");
+    ASSERT_EQ(clientDevice.getChannels()[0].getPropertyValue("StrProp"), "ChannelValue");
+
+    const auto values = clientComm->getPropertyValues({{deviceId, "StrProp", nullptr}, {channelId, "StrProp", nullptr}});
+    ASSERT_EQ(values.getCount(), 2u);
+    ASSERT_EQ(values[0], "DeviceValue");
+    ASSERT_EQ(values[1], "ChannelValue");
+}
+
+TEST_F(ConfigProtocolIntegrationTest, SetPropertyValuesBatchPartialFailure)
+{
+    const std::string channelId = serverDevice.getChannels()[0].getGlobalId();
+
+    ASSERT_THROW(client->getClientComm()->setPropertyValues({{channelId, "Missing", "SomeValue"}, {channelId, "StrProp", "SomeValue"}}),
+                 NotFoundException);
+    ASSERT_EQ(serverDevice.getChannels()[0].getPropertyValue("StrProp"), "SomeValue");
+}
+
 TEST_F(ConfigProtocolIntegrationTest, SetSignalNameAndDescriptionFromClient)
 {
     const auto serverSignal = serverDevice.getDevices()[0].getFunctionBlocks()[0].getInputPorts()[0].getSignal();
@@ -51,6 +51,8 @@ protected:
     daq::native_streaming::ReadTask createReadStopTask();
     daq::native_streaming::ReadTask discardPayload(const void* data, size_t size);
 
+    virtual void scheduleWrite(std::vector<daq::native_streaming::WriteTask>&& tasks);
+
     size_t calculatePayloadSize(const std::vector<daq::native_streaming::WriteTask>& writePayloadTasks);
     daq::native_streaming::WriteTask createWriteHeaderTask(PayloadType payloadType, size_t payloadSize);
     daq::native_streaming::WriteTask createWriteStringTask(const std::string& str);
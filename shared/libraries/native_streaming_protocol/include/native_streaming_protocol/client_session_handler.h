@@ -17,6 +17,7 @@
 #pragma once
 
 #include <native_streaming_protocol/base_session_handler.h>
+#include <native_streaming_protocol/receive_buffer_arena.h>
 
 #include <opendaq/data_descriptor_ptr.h>
 
@@ -60,5 +61,6 @@ private:
     OnSubscriptionAckCallback subscriptionAckHandler;
 
     packet_streaming::PacketStreamingClient packetStreamingClient;
+    ReceiveBufferArena receiveBufferArena;
 };
 END_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
@@ -41,7 +41,9 @@ public:
                                           const ListPtr<ISignal>& signalsList,
                                           OnSignalSubscribedCallback signalSubscribedHandler,
                                           OnSignalUnsubscribedCallback signalUnsubscribedHandler,
-                                          SetUpConfigProtocolServerCb setUpConfigProtocolServerCb);
+                                          SetUpConfigProtocolServerCb setUpConfigProtocolServerCb,
+                                          size_t maxPacketBatchSize = 0,
+                                          std::chrono::milliseconds maxPacketBatchLatency = std::chrono::milliseconds(0));
     ~NativeStreamingServerHandler() = default;
 
     void startServer(uint16_t port);
@@ -50,8 +52,17 @@ public:
     void addSignal(const SignalPtr& signal);
     void removeComponentSignals(const StringPtr& componentId);
 
+    // Sends a single packet and flushes it like a batch of one
     void sendPacket(const SignalPtr& signal, const PacketPtr& packet);
 
+    // Appends the sessions the packet was written to, so that only those need flushing afterwards
+    void sendPacket(const SignalPtr& signal,
+                    const PacketPtr& packet,
+                    std::vector<std::shared_ptr<ServerSessionHandler>>& writtenSessions);
+
+    // Flushes the pending packets of the given sessions and clears the list
+    void flushPendingPackets(std::vector<std::shared_ptr<ServerSessionHandler>>& writtenSessions);
+
 protected:
     void initSessionHandler(SessionPtr session);
     void handleTransportLayerProps(const PropertyObjectPtr& propertyObject, std::shared_ptr<ServerSessionHandler> sessionHandler);
@@ -88,6 +99,9 @@ protected:
     OnSignalUnsubscribedCallback signalUnsubscribedHandler;
     SetUpConfigProtocolServerCb setUpConfigProtocolServerCb;
 
+    size_t maxPacketBatchSize;
+    std::chrono::milliseconds maxPacketBatchLatency;
+
     std::mutex sync;
 };
 
@@ -0,0 +1,51 @@
+/*
+ * Copyright 2022-2023 Blueberry d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include <native_streaming_protocol/native_streaming_protocol_types.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+BEGIN_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
+
+// Sub-allocates received packet buffers from reference-counted slabs; a slab is released or reused once
+// all buffers taken from it are released. Allocation is done on the session read handler only.
+class ReceiveBufferArena
+{
+public:
+    static constexpr size_t DefaultSlabSize = 1024 * 1024;
+    static constexpr size_t Alignment = alignof(std::max_align_t);
+
+    explicit ReceiveBufferArena(size_t slabSize = DefaultSlabSize);
+
+    std::shared_ptr<void> allocate(size_t size);
+
+    static constexpr size_t alignSize(size_t size)
+    {
+        return (size + Alignment - 1) & ~(Alignment - 1);
+    }
+
+private:
+    size_t slabSize;
+    std::shared_ptr<uint8_t[]> slab;
+    size_t slabOffset;
+};
+
+END_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
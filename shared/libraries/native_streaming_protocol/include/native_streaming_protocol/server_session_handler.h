@@ -23,6 +23,9 @@
 
 #include <packet_streaming/packet_streaming_server.h>
 
+#include <chrono>
+#include <mutex>
+
 BEGIN_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
 
 class ServerSessionHandler : public BaseSessionHandler
@@ -33,16 +36,21 @@ public:
                          SessionPtr session,
                          OnStreamingRequestCallback streamingInitHandler,
                          OnSignalSubscriptionCallback signalSubscriptionHandler,
-                         native_streaming::OnSessionErrorCallback errorHandler);
+                         native_streaming::OnSessionErrorCallback errorHandler,
+                         size_t maxPacketBatchSize = 0,
+                         std::chrono::milliseconds maxPacketBatchLatency = std::chrono::milliseconds(0));
 
     void sendSignalAvailable(const SignalNumericIdType& signalNumericId, const SignalPtr &signal);
     void sendSignalUnavailable(const SignalNumericIdType& signalNumericId, const SignalPtr& signal);
     void sendStreamingInitDone();
     void sendPacket(const SignalNumericIdType signalId, const PacketPtr& packet);
+    void flushPackets();
     void sendSubscribingDone(const SignalNumericIdType signalNumericId);
     void sendUnsubscribingDone(const SignalNumericIdType signalNumericId);
 
     void setTransportLayerPropsHandler(const OnTrasportLayerPropertiesCallback& transportLayerPropsHandler);
+    void setBinaryEventPackets(bool enabled);
+    void setPayloadCompression(bool enabled);
 
 private:
     daq::native_streaming::ReadTask readHeader(const void* data, size_t size) override;
@@ -51,12 +59,27 @@ private:
     daq::native_streaming::ReadTask readSignalUnsubscribe(const void* data, size_t size);
     daq::native_streaming::ReadTask readTransportLayerProperties(const void* data, size_t size);
 
+    void scheduleWrite(std::vector<daq::native_streaming::WriteTask>&& tasks) override;
+
     void sendPacketBuffer(const packet_streaming::PacketBufferPtr& packetBuffer);
+    void writePendingPackets();
+    void startPacketBatchTimer();
 
     OnStreamingRequestCallback streamingInitHandler;
     OnSignalSubscriptionCallback signalSubscriptionHandler;
     OnTrasportLayerPropertiesCallback transportLayerPropsHandler;
 
     packet_streaming::PacketStreamingServer packetStreamingServer;
+    // Packets of the session can be sent from several streaming threads
+    std::mutex packetStreamingSync;
+
+    // Packets are written in batches of up to maxPacketBatchSize bytes, delayed by at most maxPacketBatchLatency
+    size_t maxPacketBatchSize;
+    std::chrono::milliseconds maxPacketBatchLatency;
+    std::vector<daq::native_streaming::WriteTask> pendingPacketTasks;
+    size_t pendingPacketBytes;
+    bool packetBatchTimerStarted;
+    std::shared_ptr<boost::asio::steady_timer> packetBatchTimer;
+    std::mutex writeSync;
 };
 END_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
@@ -23,6 +23,8 @@
 #include <opendaq/logger_component_ptr.h>
 #include <opendaq/signal_ptr.h>
 
+#include <shared_mutex>
+
 BEGIN_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
 
 using SendToClientCallback = std::function<void(std::shared_ptr<ServerSessionHandler>& sessionHandler)>;
@@ -52,7 +54,9 @@ private:
 
     std::unordered_map<std::string, std::vector<std::shared_ptr<ServerSessionHandler>>> signalsSubscribers;
     std::vector<std::shared_ptr<ServerSessionHandler>> sessionHandlers;
-    std::mutex sync;
+
+    // Sending only reads the registry, so packets of different signals can be sent from several threads at once
+    std::shared_mutex sync;
 };
 
 END_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
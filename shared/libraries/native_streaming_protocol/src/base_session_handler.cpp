@@ -173,6 +173,11 @@ void BaseSessionHandler::sendConfigurationPacket(const config_protocol::PacketBu
     auto writeHeaderTask = createWriteHeaderTask(PayloadType::PAYLOAD_TYPE_CONFIGURATION_PACKET, payloadSize);
     tasks.insert(tasks.begin(), writeHeaderTask);
 
+    scheduleWrite(std::move(tasks));
+}
+
+void BaseSessionHandler::scheduleWrite(std::vector<WriteTask>&& tasks)
+{
     session->scheduleWrite(tasks);
 }
 
@@ -40,7 +40,7 @@ void ClientSessionHandler::sendSignalSubscribe(const SignalNumericIdType& signal
     auto writeHeaderTask = createWriteHeaderTask(PayloadType::PAYLOAD_TYPE_STREAMING_SIGNAL_SUBSCRIBE_COMMAND, payloadSize);
     tasks.insert(tasks.begin(), writeHeaderTask);
 
-    session->scheduleWrite(tasks);
+    scheduleWrite(std::move(tasks));
 }
 
 void ClientSessionHandler::sendSignalUnsubscribe(const SignalNumericIdType& signalNumericId, const std::string& signalStringId)
@@ -58,7 +58,7 @@ void ClientSessionHandler::sendSignalUnsubscribe(const SignalNumericIdType& sign
     auto writeHeaderTask = createWriteHeaderTask(PayloadType::PAYLOAD_TYPE_STREAMING_SIGNAL_UNSUBSCRIBE_COMMAND, payloadSize);
     tasks.insert(tasks.begin(), writeHeaderTask);
 
-    session->scheduleWrite(tasks);
+    scheduleWrite(std::move(tasks));
 }
 
 void ClientSessionHandler::sendTransportLayerProperties(const PropertyObjectPtr& properties)
@@ -76,7 +76,7 @@ void ClientSessionHandler::sendTransportLayerProperties(const PropertyObjectPtr&
     auto writeHeaderTask = createWriteHeaderTask(PayloadType::PAYLOAD_TYPE_TRANSPORT_LAYER_PROPERTIES, payloadSize);
     tasks.insert(tasks.begin(), writeHeaderTask);
 
-    session->scheduleWrite(tasks);
+    scheduleWrite(std::move(tasks));
 }
 
 void ClientSessionHandler::sendStreamingRequest()
@@ -85,7 +85,7 @@ void ClientSessionHandler::sendStreamingRequest()
 
     tasks.push_back(createWriteHeaderTask(PayloadType::PAYLOAD_TYPE_STREAMING_PROTOCOL_INIT_REQUEST, 0));
 
-    session->scheduleWrite(tasks);
+    scheduleWrite(std::move(tasks));
 }
 
 EventPacketPtr ClientSessionHandler::getDataDescriptorChangedEventPacket(const SignalNumericIdType& signalNumericId)
@@ -99,6 +99,7 @@ ReadTask ClientSessionHandler::readPacket(const void* data, size_t size)
 
     GenericPacketHeader* packetBufferHeader {};
     void* packetBufferPayload;
+    std::shared_ptr<void> packetBufferStorage;
 
     try
     {
@@ -114,8 +115,12 @@ ReadTask ClientSessionHandler::readPacket(const void* data, size_t size)
             return createReadHeaderTask();
         }
 
+        // Header and payload are stored together in a buffer taken from the receive arena
+        const size_t payloadOffset = ReceiveBufferArena::alignSize(headerSize);
+        packetBufferStorage = receiveBufferArena.allocate(payloadOffset + (size > headerSize ? size - headerSize : 0));
+
         // Get packet buffer header from received buffer
-        packetBufferHeader = static_cast<GenericPacketHeader*>(std::malloc(headerSize));
+        packetBufferHeader = static_cast<GenericPacketHeader*>(packetBufferStorage.get());
         copyData(packetBufferHeader, data, headerSize, bytesDone, size);
         LOG_T("Received packet buffer header: header size {}, payload size {}",
               packetBufferHeader->size, packetBufferHeader->payloadSize);
@@ -124,7 +129,7 @@ ReadTask ClientSessionHandler::readPacket(const void* data, size_t size)
         // Get packet buffer payload from received buffer
         if (packetBufferHeader->payloadSize > 0)
         {
-            packetBufferPayload = std::malloc(packetBufferHeader->payloadSize);
+            packetBufferPayload = static_cast<uint8_t*>(packetBufferStorage.get()) + payloadOffset;
             copyData(packetBufferPayload, data, packetBufferHeader->payloadSize, bytesDone, size);
         }
         else
@@ -140,14 +145,7 @@ ReadTask ClientSessionHandler::readPacket(const void* data, size_t size)
     }
 
     auto recvPacketBuffer =
-        std::make_shared<PacketBuffer>(packetBufferHeader,
-                                       packetBufferPayload,
-                                       [packetBufferHeader, packetBufferPayload]()
-                                       {
-                                           std::free(packetBufferHeader);
-                                           if (packetBufferPayload != nullptr)
-                                               std::free(packetBufferPayload);
-                                       });
+        std::make_shared<PacketBuffer>(packetBufferHeader, packetBufferPayload, std::move(packetBufferStorage));
 
     packetStreamingClient.addPacketBuffer(recvPacketBuffer);
 
@@ -9,6 +9,8 @@
 
 #include <coreobjects/property_object_factory.h>
 
+#include <algorithm>
+
 BEGIN_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
 
 using namespace daq::native_streaming;
@@ -18,7 +20,9 @@ NativeStreamingServerHandler::NativeStreamingServerHandler(const ContextPtr& con
                                                            const ListPtr<ISignal>& signalsList,
                                                            OnSignalSubscribedCallback signalSubscribedHandler,
                                                            OnSignalUnsubscribedCallback signalUnsubscribedHandler,
-                                                           SetUpConfigProtocolServerCb setUpConfigProtocolServerCb)
+                                                           SetUpConfigProtocolServerCb setUpConfigProtocolServerCb,
+                                                           size_t maxPacketBatchSize,
+                                                           std::chrono::milliseconds maxPacketBatchLatency)
     : context(context)
     , ioContextPtr(ioContextPtr)
     , loggerComponent(context.getLogger().getOrAddComponent("NativeStreamingServerHandler"))
@@ -27,6 +31,8 @@ NativeStreamingServerHandler::NativeStreamingServerHandler(const ContextPtr& con
     , signalSubscribedHandler(signalSubscribedHandler)
     , signalUnsubscribedHandler(signalUnsubscribedHandler)
     , setUpConfigProtocolServerCb(setUpConfigProtocolServerCb)
+    , maxPacketBatchSize(maxPacketBatchSize)
+    , maxPacketBatchLatency(maxPacketBatchLatency)
 {
     for (const auto& signal : signalsList)
     {
@@ -81,6 +87,7 @@ void NativeStreamingServerHandler::addSignal(const SignalPtr& signal)
                                           // create and send event packet to initialize packet streaming
                                           sessionHandler->sendPacket(signalNumericId,
                                                                      createDataDescriptorChangedEventPacket(signal));
+                                          sessionHandler->flushPackets();
                                       });
 }
 
@@ -165,16 +172,39 @@ bool NativeStreamingServerHandler::handleSignalSubscription(const SignalNumericI
 }
 
 void NativeStreamingServerHandler::sendPacket(const SignalPtr& signal, const PacketPtr& packet)
+{
+    std::vector<std::shared_ptr<ServerSessionHandler>> writtenSessions;
+    sendPacket(signal, packet, writtenSessions);
+    flushPendingPackets(writtenSessions);
+}
+
+void NativeStreamingServerHandler::sendPacket(const SignalPtr& signal,
+                                              const PacketPtr& packet,
+                                              std::vector<std::shared_ptr<ServerSessionHandler>>& writtenSessions)
 {
     auto signalNumericId = findSignalNumericId(signal);
     subscribersRegistry.sendToSubscribers(
         signal,
-        [signalNumericId, &packet](std::shared_ptr<ServerSessionHandler>& sessionHandler)
+        [signalNumericId, &packet, &writtenSessions](std::shared_ptr<ServerSessionHandler>& sessionHandler)
         {
             sessionHandler->sendPacket(signalNumericId, packet);
+            if (std::find(writtenSessions.begin(), writtenSessions.end(), sessionHandler) == writtenSessions.end())
+                writtenSessions.push_back(sessionHandler);
         });
 }
 
+void NativeStreamingServerHandler::flushPendingPackets(std::vector<std::shared_ptr<ServerSessionHandler>>& writtenSessions)
+{
+    // With a latency bound set, pending packets are flushed by the session timers instead
+    if (maxPacketBatchLatency.count() == 0)
+    {
+        for (const auto& sessionHandler : writtenSessions)
+            sessionHandler->flushPackets();
+    }
+
+    writtenSessions.clear();
+}
+
 void NativeStreamingServerHandler::releaseSessionHandler(SessionPtr session)
 {
     auto toUnsubscribe = subscribersRegistry.unregisterClient(session);
@@ -190,6 +220,24 @@ void NativeStreamingServerHandler::releaseSessionHandler(SessionPtr session)
 void NativeStreamingServerHandler::handleTransportLayerProps(const PropertyObjectPtr& propertyObject,
                                                                    std::shared_ptr<ServerSessionHandler> sessionHandler)
 {
+    // Clients that do not advertise binary event packet support keep receiving JSON encoded event packets
+    if (propertyObject.hasProperty("BinaryEventPackets") &&
+        propertyObject.getProperty("BinaryEventPackets").getValueType() == ctBool)
+    {
+        Bool binaryEventPackets = propertyObject.getPropertyValue("BinaryEventPackets");
+        LOG_I("Binary event packet encoding {}", binaryEventPackets ? "enabled" : "disabled");
+        sessionHandler->setBinaryEventPackets(binaryEventPackets);
+    }
+
+    // Payload compression is only used for clients that request it, since decoding needs a matching client
+    if (propertyObject.hasProperty("PayloadCompression") &&
+        propertyObject.getProperty("PayloadCompression").getValueType() == ctBool)
+    {
+        Bool payloadCompression = propertyObject.getPropertyValue("PayloadCompression");
+        LOG_I("Data packet payload compression {}", payloadCompression ? "enabled" : "disabled");
+        sessionHandler->setPayloadCompression(payloadCompression);
+    }
+
     if (propertyObject.hasProperty("MonitoringEnabled") &&
         propertyObject.hasProperty("HeartbeatPeriod") &&
         propertyObject.hasProperty("InactivityTimeout") &&
@@ -301,7 +349,9 @@ void NativeStreamingServerHandler::initSessionHandler(SessionPtr session)
                                                                  session,
                                                                  streamingInitHandler,
                                                                  signalSubscriptionHandler,
-                                                                 errorHandler);
+                                                                 errorHandler,
+                                                                 maxPacketBatchSize,
+                                                                 maxPacketBatchLatency);
     setUpTransportLayerPropsCallback(sessionHandler);
     setUpConfigProtocolCallbacks(sessionHandler);
 
@@ -0,0 +1,38 @@
+#include <native_streaming_protocol/receive_buffer_arena.h>
+
+BEGIN_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
+
+ReceiveBufferArena::ReceiveBufferArena(size_t slabSize)
+    : slabSize(alignSize(slabSize))
+    , slabOffset(0)
+{
+}
+
+std::shared_ptr<void> ReceiveBufferArena::allocate(size_t size)
+{
+    size = alignSize(size);
+
+    // Buffers larger than a slab get dedicated memory
+    if (size > slabSize)
+    {
+        std::shared_ptr<uint8_t[]> buffer(new uint8_t[size]);
+        return std::shared_ptr<void>(buffer, buffer.get());
+    }
+
+    // Only the arena references the slab when all buffers taken from it have been released
+    if (slab && slab.use_count() == 1)
+        slabOffset = 0;
+
+    if (!slab || slabOffset + size > slabSize)
+    {
+        slab = std::shared_ptr<uint8_t[]>(new uint8_t[slabSize]);
+        slabOffset = 0;
+    }
+
+    void* address = slab.get() + slabOffset;
+    slabOffset += size;
+
+    return std::shared_ptr<void>(slab, address);
+}
+
+END_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
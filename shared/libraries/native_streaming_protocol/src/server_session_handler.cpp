@@ -15,12 +15,19 @@ ServerSessionHandler::ServerSessionHandler(const ContextPtr& daqContext,
                                            SessionPtr session,
                                            OnStreamingRequestCallback streamingInitHandler,
                                            OnSignalSubscriptionCallback signalSubscriptionHandler,
-                                           OnSessionErrorCallback errorHandler)
+                                           OnSessionErrorCallback errorHandler,
+                                           size_t maxPacketBatchSize,
+                                           std::chrono::milliseconds maxPacketBatchLatency)
     : BaseSessionHandler(daqContext, session, ioContext, errorHandler, "NativeProtocolServerSessionHandler")
     , streamingInitHandler(streamingInitHandler)
     , signalSubscriptionHandler(signalSubscriptionHandler)
     , transportLayerPropsHandler(nullptr)
     , packetStreamingServer(10)
+    , maxPacketBatchSize(maxPacketBatchSize)
+    , maxPacketBatchLatency(maxPacketBatchLatency)
+    , pendingPacketBytes(0)
+    , packetBatchTimerStarted(false)
+    , packetBatchTimer(std::make_shared<boost::asio::steady_timer>(ioContext))
 {
 }
 
@@ -53,7 +60,7 @@ void ServerSessionHandler::sendSignalAvailable(const SignalNumericIdType& signal
     auto writeHeaderTask = createWriteHeaderTask(PayloadType::PAYLOAD_TYPE_STREAMING_SIGNAL_AVAILABLE, payloadSize);
     tasks.insert(tasks.begin(), writeHeaderTask);
 
-    session->scheduleWrite(tasks);
+    scheduleWrite(std::move(tasks));
 }
 
 void ServerSessionHandler::sendSignalUnavailable(const SignalNumericIdType& signalNumericId,
@@ -72,7 +79,7 @@ void ServerSessionHandler::sendSignalUnavailable(const SignalNumericIdType& sign
     auto writeHeaderTask = createWriteHeaderTask(PayloadType::PAYLOAD_TYPE_STREAMING_SIGNAL_UNAVAILABLE, payloadSize);
     tasks.insert(tasks.begin(), writeHeaderTask);
 
-    session->scheduleWrite(tasks);
+    scheduleWrite(std::move(tasks));
 }
 
 void ServerSessionHandler::sendStreamingInitDone()
@@ -81,11 +88,12 @@ void ServerSessionHandler::sendStreamingInitDone()
 
     tasks.push_back(createWriteHeaderTask(PayloadType::PAYLOAD_TYPE_STREAMING_PROTOCOL_INIT_DONE, 0));
 
-    session->scheduleWrite(tasks);
+    scheduleWrite(std::move(tasks));
 }
 
 void ServerSessionHandler::sendPacket(const SignalNumericIdType signalId, const PacketPtr& packet)
 {
+    std::scoped_lock lock(packetStreamingSync);
     packetStreamingServer.addDaqPacket(signalId, packet);
     while (const auto packetBuffer = packetStreamingServer.getNextPacketBuffer())
     {
@@ -93,6 +101,12 @@ void ServerSessionHandler::sendPacket(const SignalNumericIdType signalId, const
     }
 }
 
+void ServerSessionHandler::flushPackets()
+{
+    std::scoped_lock lock(writeSync);
+    writePendingPackets();
+}
+
 void ServerSessionHandler::sendSubscribingDone(const SignalNumericIdType signalNumericId)
 {
     std::vector<WriteTask> tasks;
@@ -105,7 +119,7 @@ void ServerSessionHandler::sendSubscribingDone(const SignalNumericIdType signalN
     auto writeHeaderTask = createWriteHeaderTask(PayloadType::PAYLOAD_TYPE_STREAMING_SIGNAL_SUBSCRIBE_ACK, payloadSize);
     tasks.insert(tasks.begin(), writeHeaderTask);
 
-    session->scheduleWrite(tasks);
+    scheduleWrite(std::move(tasks));
 }
 
 void ServerSessionHandler::sendUnsubscribingDone(const SignalNumericIdType signalNumericId)
@@ -120,7 +134,7 @@ void ServerSessionHandler::sendUnsubscribingDone(const SignalNumericIdType signa
     auto writeHeaderTask = createWriteHeaderTask(PayloadType::PAYLOAD_TYPE_STREAMING_SIGNAL_UNSUBSCRIBE_ACK, payloadSize);
     tasks.insert(tasks.begin(), writeHeaderTask);
 
-    session->scheduleWrite(tasks);
+    scheduleWrite(std::move(tasks));
 }
 
 void ServerSessionHandler::sendPacketBuffer(const PacketBufferPtr& packetBuffer)
@@ -147,7 +161,56 @@ void ServerSessionHandler::sendPacketBuffer(const PacketBufferPtr& packetBuffer)
     auto writeHeaderTask = createWriteHeaderTask(PayloadType::PAYLOAD_TYPE_STREAMING_PACKET, payloadSize);
     tasks.insert(tasks.begin(), writeHeaderTask);
 
-    session->scheduleWrite(tasks);
+    std::scoped_lock lock(writeSync);
+
+    pendingPacketTasks.insert(pendingPacketTasks.end(), std::make_move_iterator(tasks.begin()), std::make_move_iterator(tasks.end()));
+    pendingPacketBytes += TransportHeader::PACKED_HEADER_SIZE + payloadSize;
+
+    if (pendingPacketBytes >= maxPacketBatchSize)
+        writePendingPackets();
+    else if (maxPacketBatchLatency.count() > 0)
+        startPacketBatchTimer();
+}
+
+void ServerSessionHandler::scheduleWrite(std::vector<WriteTask>&& tasks)
+{
+    std::scoped_lock lock(writeSync);
+
+    // Pending packets are written first so that messages reach the client in the order they were sent
+    pendingPacketTasks.insert(pendingPacketTasks.end(), std::make_move_iterator(tasks.begin()), std::make_move_iterator(tasks.end()));
+    writePendingPackets();
+}
+
+void ServerSessionHandler::writePendingPackets()
+{
+    if (pendingPacketTasks.empty())
+        return;
+
+    std::vector<WriteTask> tasks;
+    tasks.swap(pendingPacketTasks);
+    pendingPacketBytes = 0;
+
+    BaseSessionHandler::scheduleWrite(std::move(tasks));
+}
+
+void ServerSessionHandler::startPacketBatchTimer()
+{
+    if (packetBatchTimerStarted)
+        return;
+
+    // Called with writeSync locked; the timer is only re-armed after its handler has cleared the flag under the same lock
+    packetBatchTimerStarted = true;
+    packetBatchTimer->expires_after(maxPacketBatchLatency);
+    packetBatchTimer->async_wait(
+        [this, timerWeak = std::weak_ptr<boost::asio::steady_timer>(packetBatchTimer)](const boost::system::error_code& ec)
+        {
+            if (ec || timerWeak.expired())
+                return;
+
+            std::scoped_lock lock(writeSync);
+            packetBatchTimerStarted = false;
+            writePendingPackets();
+        });
 }
 
 ReadTask ServerSessionHandler::readSignalSubscribe(const void *data, size_t size)
@@ -242,6 +305,18 @@ ReadTask ServerSessionHandler::readTransportLayerProperties(const void* data, si
     return createReadHeaderTask();
 }
 
+void ServerSessionHandler::setBinaryEventPackets(bool enabled)
+{
+    std::scoped_lock lock(packetStreamingSync);
+    packetStreamingServer.setBinaryEventPackets(enabled);
+}
+
+void ServerSessionHandler::setPayloadCompression(bool enabled)
+{
+    std::scoped_lock lock(packetStreamingSync);
+    packetStreamingServer.setPayloadCompression(enabled);
+}
+
 void ServerSessionHandler::setTransportLayerPropsHandler(const OnTrasportLayerPropertiesCallback& transportLayerPropsHandler)
 {
     this->transportLayerPropsHandler = transportLayerPropsHandler;
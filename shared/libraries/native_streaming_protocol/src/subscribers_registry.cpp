@@ -17,7 +17,7 @@ SubscribersRegistry::SubscribersRegistry(const ContextPtr& context)
 
 void SubscribersRegistry::sendToClients(SendToClientCallback sendCallback)
 {
-    std::scoped_lock lock(sync);
+    std::shared_lock lock(sync);
     for (auto& sessionHandler : sessionHandlers)
     {
         sendCallback(sessionHandler);
@@ -27,11 +27,11 @@ void SubscribersRegistry::sendToClients(SendToClientCallback sendCallback)
 void SubscribersRegistry::sendToSubscribers(const SignalPtr& signal, SendToClientCallback sendCallback)
 {
     auto signalKey = signal.getGlobalId().toStdString();
+    std::shared_lock lock(sync);
     auto iter = signalsSubscribers.find(signalKey);
     if (iter != signalsSubscribers.end())
     {
         auto& subscribers = iter->second;
-        std::scoped_lock lock(sync);
         for (auto& sessionHandler : subscribers)
         {
             sendCallback(sessionHandler);
@@ -45,7 +45,7 @@ void SubscribersRegistry::sendToSubscribers(const SignalPtr& signal, SendToClien
 
 void SubscribersRegistry::sendToClient(SessionPtr session, SendToClientCallback sendCallback)
 {
-    std::scoped_lock lock(sync);
+    std::shared_lock lock(sync);
     auto iter = std::find_if(sessionHandlers.begin(),
                              sessionHandlers.end(),
                              [&session](std::shared_ptr<ServerSessionHandler>& handler)
@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+#include <native_streaming_protocol/receive_buffer_arena.h>
+#include <cstdint>
+#include <cstring>
+
+using namespace daq;
+using namespace daq::opendaq_native_streaming_protocol;
+
+using ReceiveBufferArenaTest = testing::Test;
+
+TEST_F(ReceiveBufferArenaTest, SubAllocatesFromSlab)
+{
+    ReceiveBufferArena arena(1024);
+
+    auto first = arena.allocate(10);
+    auto second = arena.allocate(100);
+
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(first.get()) % ReceiveBufferArena::Alignment, 0u);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(second.get()) % ReceiveBufferArena::Alignment, 0u);
+    ASSERT_EQ(static_cast<uint8_t*>(second.get()) - static_cast<uint8_t*>(first.get()),
+              static_cast<std::ptrdiff_t>(ReceiveBufferArena::alignSize(10)));
+
+    std::memset(first.get(), 1, 10);
+    std::memset(second.get(), 2, 100);
+    ASSERT_EQ(static_cast<uint8_t*>(first.get())[9], 1);
+    ASSERT_EQ(static_cast<uint8_t*>(second.get())[0], 2);
+}
+
+TEST_F(ReceiveBufferArenaTest, BuffersOutliveArena)
+{
+    std::shared_ptr<void> buffer;
+    {
+        ReceiveBufferArena arena(1024);
+        buffer = arena.allocate(64);
+    }
+
+    std::memset(buffer.get(), 0, 64);
+    ASSERT_EQ(buffer.use_count(), 1);
+}
+
+TEST_F(ReceiveBufferArenaTest, StartsNewSlabWhenFull)
+{
+    ReceiveBufferArena arena(256);
+
+    auto first = arena.allocate(200);
+    auto second = arena.allocate(200);
+
+    ASSERT_NE(first.get(), second.get());
+    ASSERT_EQ(first.use_count(), 1);
+    ASSERT_EQ(second.use_count(), 2);
+}
+
+TEST_F(ReceiveBufferArenaTest, ReusesReleasedSlab)
+{
+    ReceiveBufferArena arena(1024);
+
+    auto buffer = arena.allocate(100);
+    void* address = buffer.get();
+    arena.allocate(100);
+    buffer.reset();
+
+    buffer = arena.allocate(100);
+    ASSERT_EQ(buffer.get(), address);
+}
+
+TEST_F(ReceiveBufferArenaTest, LargeBuffer)
+{
+    ReceiveBufferArena arena(256);
+
+    auto small = arena.allocate(16);
+    auto large = arena.allocate(1000);
+    std::memset(large.get(), 0, 1000);
+
+    ASSERT_EQ(large.use_count(), 1);
+    ASSERT_EQ(small.use_count(), 2);
+}
@@ -7,6 +7,7 @@
 
 #include <memory>
 #include <future>
+#include <condition_variable>
 
 using namespace daq;
 using namespace daq::opendaq_native_streaming_protocol;
@@ -25,6 +26,43 @@ static StringPtr getDomainSignalId(const SignalPtr& signal)
     return signal.asPtr<IDeserializeComponent>(true).getDeserializedParameter("domainSignalId");
 }
 
+// Records the streamed data packets and signal available messages a client receives, in the order of arrival
+class ReceivedMessagesLog
+{
+public:
+    void add(const std::string& message)
+    {
+        {
+            std::scoped_lock lock(sync);
+            messages.push_back(message);
+        }
+        cv.notify_all();
+    }
+
+    bool waitForCount(size_t count, std::chrono::milliseconds timeout)
+    {
+        std::unique_lock lock(sync);
+        return cv.wait_for(lock, timeout, [this, count]() { return messages.size() >= count; });
+    }
+
+    std::vector<std::string> getMessages()
+    {
+        std::scoped_lock lock(sync);
+        return messages;
+    }
+
+    void clear()
+    {
+        std::scoped_lock lock(sync);
+        messages.clear();
+    }
+
+private:
+    std::mutex sync;
+    std::condition_variable cv;
+    std::vector<std::string> messages;
+};
+
 class StreamingProtocolAttributes : public ClientAttributesBase
 {
 public:
@@ -205,7 +243,9 @@ public:
         return clientHandler;
     }
 
-    void startServer(const ListPtr<ISignal>& signalsList)
+    void startServer(const ListPtr<ISignal>& signalsList,
+                     size_t maxPacketBatchSize = 0,
+                     std::chrono::milliseconds maxPacketBatchLatency = std::chrono::milliseconds(0))
     {
         startIoOperations();
         serverHandler = std::make_shared<NativeStreamingServerHandler>(serverContext,
@@ -213,10 +253,44 @@ public:
                                                                        signalsList,
                                                                        signalSubscribedHandler,
                                                                        signalUnsubscribedHandler,
-                                                                       setUpConfigProtocolServerCb);
+                                                                       setUpConfigProtocolServerCb,
+                                                                       maxPacketBatchSize,
+                                                                       maxPacketBatchLatency);
         serverHandler->startServer(NATIVE_STREAMING_SERVER_PORT);
     }
 
+    // Connects the clients and subscribes them to the signal, logging what each of them receives afterwards
+    void subscribeClientsWithLogs(const SignalPtr& serverSignal, std::vector<std::shared_ptr<ReceivedMessagesLog>>& logs)
+    {
+        for (auto& client : clients)
+        {
+            auto log = std::make_shared<ReceivedMessagesLog>();
+            logs.push_back(log);
+
+            client.packetHandler = [log](const StringPtr& /*signalStringId*/, const PacketPtr& packet)
+            {
+                if (packet.getType() == daq::PacketType::Data)
+                    log->add("packet");
+            };
+            OnSignalAvailableCallback signalAvailableHandler =
+                [log](const StringPtr& signalStringId, const StringPtr& /*serializedSignal*/)
+            {
+                log->add("available:" + signalStringId.toStdString());
+            };
+
+            client.clientHandler = createClient(client, signalAvailableHandler);
+            ASSERT_TRUE(client.clientHandler->connect(SERVER_ADDRESS, NATIVE_STREAMING_LISTENING_PORT));
+            client.clientHandler->sendStreamingRequest();
+            ASSERT_EQ(client.streamingInitFuture.wait_for(timeout), std::future_status::ready);
+
+            client.clientHandler->subscribeSignal(serverSignal.getGlobalId());
+            ASSERT_EQ(client.subscribedAckFuture.wait_for(timeout), std::future_status::ready);
+            log->clear();
+        }
+
+        ASSERT_EQ(signalSubscribedFuture.wait_for(timeout), std::future_status::ready);
+    }
+
     void stopServer()
     {
         stopIoOperations();
@@ -667,6 +741,76 @@ TEST_P(StreamingProtocolTest, SendDataPacket)
     }
 }
 
+TEST_P(StreamingProtocolTest, PacketBatchFlushedBySize)
+{
+    const auto valueDescriptor = DataDescriptorBuilder().setSampleType(SampleType::Float32).build();
+    auto serverSignal = SignalWithDescriptor(serverContext, valueDescriptor, nullptr, "signal");
+
+    // a packet of 1000 float samples stays below the batch size, the second one exceeds it
+    startServer(List<ISignal>(serverSignal), 6000, std::chrono::milliseconds(10000));
+
+    std::vector<std::shared_ptr<ReceivedMessagesLog>> logs;
+    ASSERT_NO_FATAL_FAILURE(subscribeClientsWithLogs(serverSignal, logs));
+
+    serverHandler->sendPacket(serverSignal, DataPacket(valueDescriptor, 1000));
+    for (const auto& log : logs)
+        ASSERT_FALSE(log->waitForCount(1, std::chrono::milliseconds(100)));
+
+    serverHandler->sendPacket(serverSignal, DataPacket(valueDescriptor, 1000));
+    for (const auto& log : logs)
+    {
+        ASSERT_TRUE(log->waitForCount(2, timeout));
+        ASSERT_EQ(log->getMessages(), std::vector<std::string>({"packet", "packet"}));
+    }
+}
+
+TEST_P(StreamingProtocolTest, PacketBatchFlushedByLatency)
+{
+    const auto valueDescriptor = DataDescriptorBuilder().setSampleType(SampleType::Float32).build();
+    auto serverSignal = SignalWithDescriptor(serverContext, valueDescriptor, nullptr, "signal");
+
+    const auto latency = std::chrono::milliseconds(200);
+    startServer(List<ISignal>(serverSignal), 1024 * 1024, latency);
+
+    std::vector<std::shared_ptr<ReceivedMessagesLog>> logs;
+    ASSERT_NO_FATAL_FAILURE(subscribeClientsWithLogs(serverSignal, logs));
+
+    serverHandler->sendPacket(serverSignal, DataPacket(valueDescriptor, 100));
+
+    // the batch stays under its size, so only the latency timer can write it
+    for (const auto& log : logs)
+        ASSERT_FALSE(log->waitForCount(1, latency / 4));
+
+    for (const auto& log : logs)
+        ASSERT_TRUE(log->waitForCount(1, latency + timeout));
+}
+
+TEST_P(StreamingProtocolTest, PacketBatchKeepsOrderWithControlMessages)
+{
+    const auto valueDescriptor = DataDescriptorBuilder().setSampleType(SampleType::Float32).build();
+    auto serverSignal = SignalWithDescriptor(serverContext, valueDescriptor, nullptr, "signal");
+
+    startServer(List<ISignal>(serverSignal), 1024 * 1024, std::chrono::milliseconds(10000));
+
+    std::vector<std::shared_ptr<ReceivedMessagesLog>> logs;
+    ASSERT_NO_FATAL_FAILURE(subscribeClientsWithLogs(serverSignal, logs));
+
+    serverHandler->sendPacket(serverSignal, DataPacket(valueDescriptor, 100));
+    for (const auto& log : logs)
+        ASSERT_FALSE(log->waitForCount(1, std::chrono::milliseconds(100)));
+
+    // the signal available message is a control message; it writes the pending packet ahead of itself
+    auto otherSignal = SignalWithDescriptor(serverContext, valueDescriptor, nullptr, "otherSignal");
+    serverHandler->addSignal(otherSignal);
+
+    for (const auto& log : logs)
+    {
+        ASSERT_TRUE(log->waitForCount(2, timeout));
+        ASSERT_EQ(log->getMessages(),
+                  std::vector<std::string>({"packet", "available:" + otherSignal.getGlobalId().toStdString()}));
+    }
+}
+
 TEST_P(StreamingProtocolTest, AddNotPublicSignal)
 {
     startServer(List<ISignal>());
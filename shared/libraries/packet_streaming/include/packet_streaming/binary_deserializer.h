@@ -0,0 +1,82 @@
+/*
+ * Copyright 2022-2023 Blueberry d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <packet_streaming/binary_serializer.h>
+#include <coretypes/baseobject_factory.h>
+#include <coretypes/function_ptr.h>
+
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace daq::packet_streaming
+{
+
+// Parsed node of a binary serialized object tree. Objects keep their keys and values in parallel vectors
+// in the order they were written, which is also the order in which getKeys reports them.
+struct BinaryValue
+{
+    BinaryToken type{BinaryToken::null};
+    Int intValue{};
+    Float floatValue{};
+    std::string_view stringValue;
+    std::vector<std::string_view> keys;
+    std::vector<BinaryValue> items;
+
+    const BinaryValue* find(std::string_view key) const;
+};
+
+// Owns a copy of the serialized bytes that the string views of the parsed tree point into
+struct BinaryDocument
+{
+    std::vector<uint8_t> data;
+    BinaryValue root;
+};
+
+using BinaryDocumentPtr = std::shared_ptr<const BinaryDocument>;
+
+class BinaryDeserializer
+{
+public:
+    BaseObjectPtr deserialize(const void* data,
+                              size_t size,
+                              const BaseObjectPtr& context = nullptr,
+                              const FunctionPtr& factoryCallback = nullptr) const;
+
+    static BinaryDocumentPtr Parse(const void* data, size_t size);
+    static ErrCode Deserialize(const BinaryDocumentPtr& document,
+                               const BinaryValue& value,
+                               IBaseObject* context,
+                               IFunction* factoryCallback,
+                               IBaseObject** object);
+    static CoreType GetCoreType(const BinaryValue& value) noexcept;
+
+private:
+    static ErrCode DeserializeTagged(const BinaryDocumentPtr& document,
+                                     const BinaryValue& value,
+                                     IBaseObject* context,
+                                     IFunction* factoryCallback,
+                                     IBaseObject** object);
+    static ErrCode DeserializeList(const BinaryDocumentPtr& document,
+                                   const BinaryValue& value,
+                                   IBaseObject* context,
+                                   IFunction* factoryCallback,
+                                   IBaseObject** object);
+};
+
+}
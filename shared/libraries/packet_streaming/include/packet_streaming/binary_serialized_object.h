@@ -0,0 +1,81 @@
+/*
+ * Copyright 2022-2023 Blueberry d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <packet_streaming/binary_deserializer.h>
+#include <coretypes/serialized_object.h>
+#include <coretypes/serialized_list.h>
+
+namespace daq::packet_streaming
+{
+
+class BinarySerializedObject : public ImplementationOf<ISerializedObject>
+{
+public:
+    explicit BinarySerializedObject(BinaryDocumentPtr document, const BinaryValue* object, bool isRoot = false);
+
+    ErrCode INTERFACE_FUNC readSerializedObject(IString* key, ISerializedObject** plainObj) override;
+    ErrCode INTERFACE_FUNC readSerializedList(IString* key, ISerializedList** list) override;
+    ErrCode INTERFACE_FUNC readList(IString* key, IBaseObject* context, IFunction* factoryCallback, IList** list) override;
+    ErrCode INTERFACE_FUNC readObject(IString* key, IBaseObject* context, IFunction* factoryCallback, IBaseObject** obj) override;
+    ErrCode INTERFACE_FUNC readString(IString* key, IString** string) override;
+    ErrCode INTERFACE_FUNC readBool(IString* key, Bool* boolean) override;
+    ErrCode INTERFACE_FUNC readInt(IString* key, Int* integer) override;
+    ErrCode INTERFACE_FUNC readFloat(IString* key, Float* real) override;
+    ErrCode INTERFACE_FUNC hasKey(IString* key, Bool* hasKey) override;
+
+    ErrCode INTERFACE_FUNC getKeys(IList** list) override;
+    ErrCode INTERFACE_FUNC getType(IString* key, CoreType* type) override;
+    ErrCode INTERFACE_FUNC isRoot(Bool* isRoot) override;
+
+    ErrCode INTERFACE_FUNC toJson(IString** jsonString) override;
+
+    ErrCode INTERFACE_FUNC toString(CharPtr* str) override;
+
+private:
+    ErrCode findMember(IString* key, const BinaryValue** member) const;
+
+    BinaryDocumentPtr document;
+    const BinaryValue* object;
+    Bool root;
+};
+
+class BinarySerializedList : public ImplementationOf<ISerializedList>
+{
+public:
+    explicit BinarySerializedList(BinaryDocumentPtr document, const BinaryValue* list);
+
+    ErrCode INTERFACE_FUNC readSerializedObject(ISerializedObject** plainObj) override;
+    ErrCode INTERFACE_FUNC readSerializedList(ISerializedList** list) override;
+    ErrCode INTERFACE_FUNC readList(IBaseObject* context, IFunction* factoryCallback, IList** list) override;
+    ErrCode INTERFACE_FUNC readObject(IBaseObject* context, IFunction* factoryCallback, IBaseObject** obj) override;
+    ErrCode INTERFACE_FUNC readString(IString** string) override;
+    ErrCode INTERFACE_FUNC readBool(Bool* boolean) override;
+    ErrCode INTERFACE_FUNC readFloat(Float* real) override;
+    ErrCode INTERFACE_FUNC readInt(Int* integer) override;
+    ErrCode INTERFACE_FUNC getCount(SizeT* size) override;
+    ErrCode INTERFACE_FUNC getCurrentItemType(CoreType* type) override;
+
+    ErrCode INTERFACE_FUNC toString(CharPtr* str) override;
+
+private:
+    BinaryDocumentPtr document;
+    const BinaryValue* list;
+    size_t index;
+};
+
+}
@@ -0,0 +1,96 @@
+/*
+ * Copyright 2022-2023 Blueberry d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <coretypes/serializer.h>
+#include <coretypes/intfs.h>
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace daq::packet_streaming
+{
+
+// Packet header version of event packets whose payload is encoded with BinarySerializerImpl
+constexpr uint8_t PacketVersionEventBinary = 1;
+
+// Tokens of the binary serialization format. Keys and type ids of tagged objects are interned:
+// the first occurrence is written as a literal and later ones as an index into the table of literals.
+enum class BinaryToken : uint8_t
+{
+    null = 0,
+    boolFalse,
+    boolTrue,
+    integer,
+    floating,
+    string,
+    startObject,
+    startTaggedObject,
+    startList,
+    end,
+    key
+};
+
+// Serializer producing a compact binary representation of the same object tree that JsonSerializer writes.
+// The output contains embedded zero bytes and is therefore available through getBuffer() rather than getOutput().
+class BinarySerializerImpl : public ImplementationOf<ISerializer>
+{
+public:
+    BinarySerializerImpl();
+
+    ErrCode INTERFACE_FUNC startTaggedObject(ISerializable* serializable) override;
+    ErrCode INTERFACE_FUNC startObject() override;
+    ErrCode INTERFACE_FUNC endObject() override;
+
+    ErrCode INTERFACE_FUNC startList() override;
+    ErrCode INTERFACE_FUNC endList() override;
+
+    ErrCode INTERFACE_FUNC getOutput(IString** serialized) override;
+
+    ErrCode INTERFACE_FUNC key(ConstCharPtr string) override;
+    ErrCode INTERFACE_FUNC keyStr(IString* name) override;
+    ErrCode INTERFACE_FUNC keyRaw(ConstCharPtr string, SizeT length) override;
+
+    ErrCode INTERFACE_FUNC writeInt(Int integer) override;
+    ErrCode INTERFACE_FUNC writeBool(Bool boolean) override;
+    ErrCode INTERFACE_FUNC writeFloat(Float real) override;
+    ErrCode INTERFACE_FUNC writeString(ConstCharPtr string, SizeT length) override;
+    ErrCode INTERFACE_FUNC writeNull() override;
+
+    ErrCode INTERFACE_FUNC reset() override;
+    ErrCode INTERFACE_FUNC isComplete(Bool* complete) override;
+
+    ErrCode INTERFACE_FUNC toString(CharPtr* str) override;
+
+    const std::vector<uint8_t>& getBuffer() const;
+    std::vector<uint8_t> takeBuffer();
+
+private:
+    void writeToken(BinaryToken token);
+    void writeVarUInt(uint64_t value);
+    void writeInterned(const char* string, size_t length);
+    void valueWritten();
+
+    std::vector<uint8_t> buffer;
+    std::unordered_map<std::string, uint64_t> internedStrings;
+    size_t depth;
+    bool started;
+};
+
+}
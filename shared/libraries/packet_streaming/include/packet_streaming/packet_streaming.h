@@ -29,6 +29,7 @@ enum PacketType: uint8_t { event = 0, data, release, alreadySent };
 
 #define PACKET_FLAG_CAN_RELEASE            0x1
 #define PACKET_FLAG_OFFSET_TYPE_MASK       (0x2 | 0x4)
+#define PACKET_FLAG_COMPRESSED             0x8
 
 #define PACKET_FLAG_OFFSET_TYPE_SHIFT      1
 
@@ -68,11 +69,14 @@ struct PacketBuffer
     PacketBuffer(const PacketBuffer&) = delete;
     PacketBuffer(PacketBuffer&& packetBuffer) noexcept;
     PacketBuffer(GenericPacketHeader* packetHeader, const void* payload, std::function<void()> onDestroy);
+    PacketBuffer(GenericPacketHeader* packetHeader, const void* payload, std::shared_ptr<void> storage);
 
     GenericPacketHeader* packetHeader;
     const void* payload;
 
     std::function<void()> onDestroy;
+    // Keeps the memory of the header and payload alive when it is owned by a shared buffer
+    std::shared_ptr<void> storage;
     std::vector<uint32_t> additionalSignalIds;
 
     ~PacketBuffer();
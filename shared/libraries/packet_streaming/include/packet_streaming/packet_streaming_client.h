@@ -17,6 +17,7 @@
 #pragma once
 
 #include <packet_streaming/packet_streaming.h>
+#include <packet_streaming/binary_deserializer.h>
 #include <opendaq/data_packet_ptr.h>
 #include "opendaq/event_packet_ptr.h"
 #include <queue>
@@ -46,6 +47,7 @@ public:
     EventPacketPtr getDataDescriptorChangedEventPacket(uint32_t signalId) const;
 private:
     DeserializerPtr jsonDeserializer;
+    BinaryDeserializer binaryDeserializer;
     std::queue<std::tuple<uint32_t, PacketPtr>> queue;
     std::unordered_map<uint32_t, DataDescriptorPtr> dataDescriptors;
     std::unordered_map<uint32_t, DataDescriptorPtr> domainDescriptors;
@@ -19,7 +19,9 @@
 #include <packet_streaming/packet_streaming.h>
 #include <opendaq/data_packet_ptr.h>
 #include <opendaq/event_packet_ptr.h>
+#include <atomic>
 #include <queue>
+#include <vector>
 
 namespace daq::packet_streaming
 {
@@ -38,7 +40,7 @@ enum class ReleaseAction { markForRelease, subscribe, alreadySent };
 class PacketStreamingServer
 {
 public:
-    PacketStreamingServer(size_t releaseThreshold = 1);
+    PacketStreamingServer(size_t releaseThreshold = 1, bool binaryEventPackets = false);
 
     void addDaqPacket(const uint32_t signalId, const PacketPtr& packet);
     void addDaqPacket(const uint32_t signalId, PacketPtr&& packet);
@@ -47,19 +49,33 @@ public:
     void checkAndSendReleasePacket(bool force);
     void addAlreadySentPacket(uint32_t signalId, Int packetId, Int domainPacketId, bool markForRelease);
 
+    // Event packets are encoded in binary only when the receiving client is known to support it; JSON otherwise
+    void setBinaryEventPackets(bool enabled);
+
+    // Data packets of integer signals are sent delta/bit-pack encoded when the receiving client supports it
+    // and the encoded payload is smaller than the raw one
+    void setPayloadCompression(bool enabled);
+
 private:
     SerializerPtr jsonSerializer;
+    SerializerPtr binarySerializer;
+    std::atomic<bool> binaryEventPackets;
+    std::atomic<bool> payloadCompression;
     std::queue<PacketBufferPtr> queue;
     std::unordered_map<uint32_t, DataDescriptorPtr> dataDescriptors;
+    std::unordered_map<uint32_t, size_t> compressionElementSizes;
     PacketCollectionPtr packetCollection;
     size_t releaseThreshold;
 
     void addEventPacket(const uint32_t signalId, const EventPacketPtr& packet);
+    PacketBufferPtr createJsonEventPacketBuffer(GenericPacketHeader* packetHeader, const EventPacketPtr& packet);
+    PacketBufferPtr createBinaryEventPacketBuffer(GenericPacketHeader* packetHeader, const EventPacketPtr& packet);
     template <bool CheckRefCount>
     static bool canReleasePacket(const DataPacketPtr& packet);
     bool shouldSendPacket(const DataPacketPtr& packet, Int packetId, bool markForRelease) const;
     static void setOffset(const DataPacketPtr& packet, DataPacketHeader* packetHeader);
     static Int getDomainPacketId(const DataPacketPtr& packet);
+    std::shared_ptr<std::vector<uint8_t>> compressPayload(uint32_t signalId, const void* data, size_t size) const;
 
     template <class DataPacket>
     void addDataPacket(const uint32_t signalId, DataPacket&& packet);
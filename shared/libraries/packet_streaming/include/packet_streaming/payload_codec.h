@@ -0,0 +1,62 @@
+/*
+ * Copyright 2022-2023 Blueberry d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <opendaq/data_descriptor_ptr.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace daq::packet_streaming
+{
+
+enum class PayloadCodecId : uint8_t
+{
+    none = 0,
+    deltaZigZagBitPack
+};
+
+// Prefix of a data packet payload sent with the PACKET_FLAG_COMPRESSED flag set
+struct CompressedPayloadHeader
+{
+    PayloadCodecId codecId;
+    uint8_t elementSize;
+    uint16_t reserved;
+    uint32_t rawSize;
+};
+
+// Lossless codec for integer samples. Each element is replaced by the difference to the previous one, the
+// differences are zigzag encoded so that small negative values stay small, and each block of elements is
+// bit-packed with the bit width of its largest value. Slowly varying signals need only a few bits per sample.
+class DeltaBitPackCodec
+{
+public:
+    // Returns the size of the elements the codec operates on, or 0 if samples of the descriptor cannot be compressed
+    static size_t getElementSize(const DataDescriptorPtr& descriptor);
+
+    // Appends the header and the encoded data to the output. Returns false, leaving the output unchanged,
+    // when the encoded payload would not be smaller than the raw one
+    static bool encode(const void* data, size_t size, size_t elementSize, std::vector<uint8_t>& output);
+
+    // Decodes a payload produced by encode into the raw buffer of the given size
+    static void decode(const void* payload, size_t payloadSize, void* data, size_t size);
+
+private:
+    static constexpr size_t BlockSize = 128;
+};
+
+}
@@ -0,0 +1,336 @@
+#include <packet_streaming/binary_deserializer.h>
+#include <packet_streaming/binary_serialized_object.h>
+#include <packet_streaming/packet_streaming.h>
+#include <coretypes/coretypes.h>
+#include <cstring>
+
+namespace daq::packet_streaming
+{
+
+namespace
+{
+
+// Guards against stack exhaustion on malformed or hostile payloads
+constexpr size_t maxNestingDepth = 256;
+
+class BinaryParser
+{
+public:
+    BinaryParser(const uint8_t* data, size_t size)
+        : pos(data)
+        , end(data + size)
+    {
+    }
+
+    void parseValue(BinaryValue& value, size_t depth)
+    {
+        if (depth > maxNestingDepth)
+            throw PacketStreamingException("Binary serialized object is nested too deeply");
+
+        const auto token = static_cast<BinaryToken>(readByte());
+        switch (token)
+        {
+            case BinaryToken::null:
+            case BinaryToken::boolFalse:
+            case BinaryToken::boolTrue:
+                value.type = token;
+                break;
+            case BinaryToken::integer:
+            {
+                const auto encoded = readVarUInt();
+                value.type = token;
+                value.intValue = static_cast<Int>((encoded >> 1) ^ (0 - (encoded & 1)));
+                break;
+            }
+            case BinaryToken::floating:
+            {
+                const auto bytes = readBytes(sizeof(Float));
+                value.type = token;
+                std::memcpy(&value.floatValue, bytes.data(), sizeof(Float));
+                break;
+            }
+            case BinaryToken::string:
+                value.type = token;
+                value.stringValue = readBytes(static_cast<size_t>(readVarUInt()));
+                break;
+            case BinaryToken::startTaggedObject:
+            {
+                value.type = BinaryToken::startObject;
+                value.keys.emplace_back("__type");
+                auto& typeId = value.items.emplace_back();
+                typeId.type = BinaryToken::string;
+                typeId.stringValue = readInterned();
+                parseMembers(value, depth);
+                break;
+            }
+            case BinaryToken::startObject:
+                value.type = token;
+                parseMembers(value, depth);
+                break;
+            case BinaryToken::startList:
+                value.type = token;
+                while (peekByte() != static_cast<uint8_t>(BinaryToken::end))
+                    parseValue(value.items.emplace_back(), depth + 1);
+                pos++;
+                break;
+            default:
+                throw PacketStreamingException("Unexpected token in binary serialized object");
+        }
+    }
+
+    bool atEnd() const
+    {
+        return pos == end;
+    }
+
+private:
+    void parseMembers(BinaryValue& value, size_t depth)
+    {
+        while (true)
+        {
+            const auto token = static_cast<BinaryToken>(readByte());
+            if (token == BinaryToken::end)
+                return;
+            if (token != BinaryToken::key)
+                throw PacketStreamingException("Expected key in binary serialized object");
+
+            value.keys.push_back(readInterned());
+            parseValue(value.items.emplace_back(), depth + 1);
+        }
+    }
+
+    uint8_t peekByte() const
+    {
+        if (pos == end)
+            throw PacketStreamingException("Binary serialized object is truncated");
+        return *pos;
+    }
+
+    uint8_t readByte()
+    {
+        const auto byte = peekByte();
+        pos++;
+        return byte;
+    }
+
+    uint64_t readVarUInt()
+    {
+        uint64_t value = 0;
+        for (unsigned shift = 0; shift < 64; shift += 7)
+        {
+            const auto byte = readByte();
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if (!(byte & 0x80))
+                return value;
+        }
+        throw PacketStreamingException("Invalid variable-length integer in binary serialized object");
+    }
+
+    std::string_view readBytes(size_t length)
+    {
+        if (static_cast<size_t>(end - pos) < length)
+            throw PacketStreamingException("Binary serialized object is truncated");
+
+        std::string_view bytes(reinterpret_cast<const char*>(pos), length);
+        pos += length;
+        return bytes;
+    }
+
+    std::string_view readInterned()
+    {
+        const auto encoded = readVarUInt();
+        if (encoded & 1)
+            return internedStrings.emplace_back(readBytes(static_cast<size_t>(encoded >> 1)));
+
+        const auto index = static_cast<size_t>(encoded >> 1);
+        if (index >= internedStrings.size())
+            throw PacketStreamingException("Invalid string reference in binary serialized object");
+        return internedStrings[index];
+    }
+
+    const uint8_t* pos;
+    const uint8_t* end;
+    std::vector<std::string_view> internedStrings;
+};
+
+}
+
+const BinaryValue* BinaryValue::find(std::string_view key) const
+{
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+        if (keys[i] == key)
+            return &items[i];
+    }
+    return nullptr;
+}
+
+BaseObjectPtr BinaryDeserializer::deserialize(const void* data,
+                                              size_t size,
+                                              const BaseObjectPtr& context,
+                                              const FunctionPtr& factoryCallback) const
+{
+    const auto document = Parse(data, size);
+
+    BaseObjectPtr object;
+    checkErrorInfo(Deserialize(document, document->root, context, factoryCallback, &object));
+    return object;
+}
+
+BinaryDocumentPtr BinaryDeserializer::Parse(const void* data, size_t size)
+{
+    auto document = std::make_shared<BinaryDocument>();
+    document->data.assign(static_cast<const uint8_t*>(data), static_cast<const uint8_t*>(data) + size);
+
+    BinaryParser parser(document->data.data(), document->data.size());
+    parser.parseValue(document->root, 0);
+    if (!parser.atEnd())
+        throw PacketStreamingException("Unexpected data after binary serialized object");
+
+    return document;
+}
+
+ErrCode BinaryDeserializer::Deserialize(const BinaryDocumentPtr& document,
+                                        const BinaryValue& value,
+                                        IBaseObject* context,
+                                        IFunction* factoryCallback,
+                                        IBaseObject** object)
+{
+    switch (value.type)
+    {
+        case BinaryToken::null:
+            *object = nullptr;
+            return OPENDAQ_SUCCESS;
+        case BinaryToken::boolFalse:
+        case BinaryToken::boolTrue:
+        {
+            IBoolean* boolean;
+            const ErrCode errCode = createBoolean(&boolean, value.type == BinaryToken::boolTrue);
+            *object = boolean;
+            return errCode;
+        }
+        case BinaryToken::integer:
+        {
+            IInteger* integer;
+            const ErrCode errCode = createInteger(&integer, value.intValue);
+            *object = integer;
+            return errCode;
+        }
+        case BinaryToken::floating:
+        {
+            IFloat* floating;
+            const ErrCode errCode = createFloat(&floating, value.floatValue);
+            *object = floating;
+            return errCode;
+        }
+        case BinaryToken::string:
+        {
+            IString* string;
+            const ErrCode errCode = createStringN(&string, value.stringValue.data(), value.stringValue.size());
+            *object = string;
+            return errCode;
+        }
+        case BinaryToken::startObject:
+            return DeserializeTagged(document, value, context, factoryCallback, object);
+        case BinaryToken::startList:
+            return DeserializeList(document, value, context, factoryCallback, object);
+        default:
+            *object = nullptr;
+            return OPENDAQ_ERR_DESERIALIZE_UNKNOWN_TYPE;
+    }
+}
+
+CoreType BinaryDeserializer::GetCoreType(const BinaryValue& value) noexcept
+{
+    switch (value.type)
+    {
+        case BinaryToken::null:
+        case BinaryToken::startObject:
+            return ctObject;
+        case BinaryToken::boolFalse:
+        case BinaryToken::boolTrue:
+            return ctBool;
+        case BinaryToken::integer:
+            return ctInt;
+        case BinaryToken::floating:
+            return ctFloat;
+        case BinaryToken::string:
+            return ctString;
+        case BinaryToken::startList:
+            return ctList;
+        default:
+            return ctUndefined;
+    }
+}
+
+ErrCode BinaryDeserializer::DeserializeTagged(const BinaryDocumentPtr& document,
+                                              const BinaryValue& value,
+                                              IBaseObject* context,
+                                              IFunction* factoryCallback,
+                                              IBaseObject** object)
+{
+    const auto typeIdValue = value.find("__type");
+    if (typeIdValue == nullptr)
+        return OPENDAQ_ERR_DESERIALIZE_NO_TYPE;
+    if (typeIdValue->type != BinaryToken::string)
+        return OPENDAQ_ERR_DESERIALIZE_UNKNOWN_TYPE;
+
+    const std::string typeId(typeIdValue->stringValue);
+
+    SerializedObjectPtr serializedObject;
+    ErrCode errCode = createObject<ISerializedObject, BinarySerializedObject>(&serializedObject, document, &value);
+    if (OPENDAQ_FAILED(errCode))
+        return errCode;
+
+    bool constructedFromCallbackFactory = false;
+    errCode = daqTry(
+        [&]
+        {
+            const auto factoryCallbackPtr = FunctionPtr::Borrow(factoryCallback);
+            if (factoryCallbackPtr.assigned())
+            {
+                *object = factoryCallbackPtr.call(String(typeId), serializedObject, context, factoryCallback).detach();
+                constructedFromCallbackFactory = *object != nullptr;
+            }
+
+            return OPENDAQ_SUCCESS;
+        });
+    if (OPENDAQ_FAILED(errCode) || constructedFromCallbackFactory)
+        return errCode;
+
+    daqDeserializerFactory factory{};
+    errCode = daqGetSerializerFactory(typeId.c_str(), &factory);
+    if (OPENDAQ_FAILED(errCode))
+        return errCode;
+
+    return factory(serializedObject, context, factoryCallback, object);
+}
+
+ErrCode BinaryDeserializer::DeserializeList(const BinaryDocumentPtr& document,
+                                            const BinaryValue& value,
+                                            IBaseObject* context,
+                                            IFunction* factoryCallback,
+                                            IBaseObject** object)
+{
+    ListPtr<IBaseObject> list;
+    ErrCode errCode = createList(&list);
+    if (OPENDAQ_FAILED(errCode))
+        return errCode;
+
+    for (const auto& item : value.items)
+    {
+        IBaseObject* itemObject;
+        errCode = Deserialize(document, item, context, factoryCallback, &itemObject);
+        if (OPENDAQ_FAILED(errCode))
+            return errCode;
+
+        errCode = list->moveBack(itemObject);
+        if (OPENDAQ_FAILED(errCode))
+            return errCode;
+    }
+
+    *object = list.detach();
+    return OPENDAQ_SUCCESS;
+}
+
+}
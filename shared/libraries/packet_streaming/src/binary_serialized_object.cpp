@@ -0,0 +1,397 @@
+#include <packet_streaming/binary_serialized_object.h>
+#include <coretypes/coretypes.h>
+#include <coretypes/validation.h>
+
+namespace daq::packet_streaming
+{
+
+BinarySerializedObject::BinarySerializedObject(BinaryDocumentPtr document, const BinaryValue* object, bool isRoot)
+    : document(std::move(document))
+    , object(object)
+    , root(isRoot)
+{
+}
+
+ErrCode BinarySerializedObject::findMember(IString* key, const BinaryValue** member) const
+{
+    if (key == nullptr)
+        return OPENDAQ_ERR_ARGUMENT_NULL;
+
+    ConstCharPtr str;
+    ErrCode errCode = key->getCharPtr(&str);
+    if (OPENDAQ_FAILED(errCode))
+        return errCode;
+
+    *member = object->find(str);
+    return *member != nullptr ? OPENDAQ_SUCCESS : OPENDAQ_ERR_NOTFOUND;
+}
+
+ErrCode BinarySerializedObject::readSerializedObject(IString* key, ISerializedObject** plainObj)
+{
+    OPENDAQ_PARAM_NOT_NULL(plainObj);
+
+    const BinaryValue* member;
+    ErrCode errCode = findMember(key, &member);
+    if (OPENDAQ_FAILED(errCode))
+        return errCode;
+
+    if (member->type != BinaryToken::startObject)
+        return OPENDAQ_ERR_INVALIDTYPE;
+
+    return createObject<ISerializedObject, BinarySerializedObject>(plainObj, document, member, false);
+}
+
+ErrCode BinarySerializedObject::readSerializedList(IString* key, ISerializedList** list)
+{
+    OPENDAQ_PARAM_NOT_NULL(list);
+
+    const BinaryValue* member;
+    ErrCode errCode = findMember(key, &member);
+    if (OPENDAQ_FAILED(errCode))
+        return errCode;
+
+    if (member->type != BinaryToken::startList)
+        return OPENDAQ_ERR_INVALIDTYPE;
+
+    return createObject<ISerializedList, BinarySerializedList>(list, document, member);
+}
+
+ErrCode BinarySerializedObject::readList(IString* key, IBaseObject* context, IFunction* factoryCallback, IList** list)
+{
+    OPENDAQ_PARAM_NOT_NULL(list);
+
+    const BinaryValue* member;
+    ErrCode errCode = findMember(key, &member);
+    if (OPENDAQ_FAILED(errCode))
+        return errCode;
+
+    if (member->type != BinaryToken::startList)
+        return OPENDAQ_ERR_INVALIDTYPE;
+
+    return BinaryDeserializer::Deserialize(document, *member, context, factoryCallback, reinterpret_cast<IBaseObject**>(list));
+}
+
+ErrCode BinarySerializedObject::readObject(IString* key, IBaseObject* context, IFunction* factoryCallback, IBaseObject** obj)
+{
+    OPENDAQ_PARAM_NOT_NULL(obj);
+
+    const BinaryValue* member;
+    ErrCode errCode = findMember(key, &member);
+    if (OPENDAQ_FAILED(errCode))
+        return errCode;
+
+    return BinaryDeserializer::Deserialize(document, *member, context, factoryCallback, obj);
+}
+
+ErrCode BinarySerializedObject::readString(IString* key, IString** string)
+{
+    OPENDAQ_PARAM_NOT_NULL(string);
+
+    const BinaryValue* member;
+    ErrCode errCode = findMember(key, &member);
+    if (OPENDAQ_FAILED(errCode))
+        return errCode;
+
+    if (member->type != BinaryToken::string)
+        return OPENDAQ_ERR_INVALIDTYPE;
+
+    return createStringN(string, member->stringValue.data(), member->stringValue.size());
+}
+
+ErrCode BinarySerializedObject::readBool(IString* key, Bool* boolean)
+{
+    OPENDAQ_PARAM_NOT_NULL(boolean);
+
+    const BinaryValue* member;
+    ErrCode errCode = findMember(key, &member);
+    if (OPENDAQ_FAILED(errCode))
+        return errCode;
+
+    if (member->type != BinaryToken::boolTrue && member->type != BinaryToken::boolFalse)
+        return OPENDAQ_ERR_INVALIDTYPE;
+
+    *boolean = member->type == BinaryToken::boolTrue;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode BinarySerializedObject::readInt(IString* key, Int* integer)
+{
+    OPENDAQ_PARAM_NOT_NULL(integer);
+
+    const BinaryValue* member;
+    ErrCode errCode = findMember(key, &member);
+    if (OPENDAQ_FAILED(errCode))
+        return errCode;
+
+    if (member->type != BinaryToken::integer)
+        return OPENDAQ_ERR_INVALIDTYPE;
+
+    *integer = member->intValue;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode BinarySerializedObject::readFloat(IString* key, Float* real)
+{
+    OPENDAQ_PARAM_NOT_NULL(real);
+
+    const BinaryValue* member;
+    ErrCode errCode = findMember(key, &member);
+    if (OPENDAQ_FAILED(errCode))
+        return errCode;
+
+    if (member->type != BinaryToken::floating)
+        return OPENDAQ_ERR_INVALIDTYPE;
+
+    *real = member->floatValue;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode BinarySerializedObject::hasKey(IString* key, Bool* hasKey)
+{
+    OPENDAQ_PARAM_NOT_NULL(hasKey);
+
+    const BinaryValue* member;
+    ErrCode errCode = findMember(key, &member);
+    if (errCode == OPENDAQ_ERR_NOTFOUND)
+    {
+        *hasKey = False;
+        return OPENDAQ_SUCCESS;
+    }
+    if (OPENDAQ_FAILED(errCode))
+        return errCode;
+
+    *hasKey = True;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode BinarySerializedObject::getKeys(IList** list)
+{
+    OPENDAQ_PARAM_NOT_NULL(list);
+
+    ListPtr<IString> keys;
+    ErrCode errCode = createList(&keys);
+    if (OPENDAQ_FAILED(errCode))
+        return errCode;
+
+    for (const auto& key : object->keys)
+    {
+        IString* keyString;
+        errCode = createStringN(&keyString, key.data(), key.size());
+        if (OPENDAQ_FAILED(errCode))
+            return errCode;
+
+        errCode = keys->moveBack(keyString);
+        if (OPENDAQ_FAILED(errCode))
+            return errCode;
+    }
+
+    *list = keys.detach();
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode BinarySerializedObject::getType(IString* key, CoreType* type)
+{
+    OPENDAQ_PARAM_NOT_NULL(type);
+
+    const BinaryValue* member;
+    ErrCode errCode = findMember(key, &member);
+    if (OPENDAQ_FAILED(errCode))
+        return errCode;
+
+    *type = BinaryDeserializer::GetCoreType(*member);
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode BinarySerializedObject::isRoot(Bool* isRoot)
+{
+    OPENDAQ_PARAM_NOT_NULL(isRoot);
+
+    *isRoot = root;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode BinarySerializedObject::toJson(IString** /*jsonString*/)
+{
+    return OPENDAQ_ERR_NOTIMPLEMENTED;
+}
+
+ErrCode BinarySerializedObject::toString(CharPtr* str)
+{
+    OPENDAQ_PARAM_NOT_NULL(str);
+
+    return daqDuplicateCharPtr("BinarySerializedObject", str);
+}
+
+BinarySerializedList::BinarySerializedList(BinaryDocumentPtr document, const BinaryValue* list)
+    : document(std::move(document))
+    , list(list)
+    , index(0)
+{
+}
+
+ErrCode BinarySerializedList::readSerializedObject(ISerializedObject** plainObj)
+{
+    OPENDAQ_PARAM_NOT_NULL(plainObj);
+
+    if (index >= list->items.size())
+        return OPENDAQ_ERR_OUTOFRANGE;
+
+    const auto& item = list->items[index];
+    if (item.type == BinaryToken::null)
+    {
+        index++;
+        *plainObj = nullptr;
+        return OPENDAQ_SUCCESS;
+    }
+
+    if (item.type != BinaryToken::startObject)
+        return OPENDAQ_ERR_INVALIDTYPE;
+
+    index++;
+    return createObject<ISerializedObject, BinarySerializedObject>(plainObj, document, &item, false);
+}
+
+ErrCode BinarySerializedList::readSerializedList(ISerializedList** serializedList)
+{
+    OPENDAQ_PARAM_NOT_NULL(serializedList);
+
+    if (index >= list->items.size())
+        return OPENDAQ_ERR_OUTOFRANGE;
+
+    const auto& item = list->items[index];
+    if (item.type != BinaryToken::startList)
+        return OPENDAQ_ERR_INVALIDTYPE;
+
+    index++;
+    return createObject<ISerializedList, BinarySerializedList>(serializedList, document, &item);
+}
+
+ErrCode BinarySerializedList::readList(IBaseObject* context, IFunction* factoryCallback, IList** readList)
+{
+    OPENDAQ_PARAM_NOT_NULL(readList);
+
+    if (index >= list->items.size())
+        return OPENDAQ_ERR_OUTOFRANGE;
+
+    const auto& item = list->items[index];
+    if (item.type == BinaryToken::null)
+    {
+        index++;
+        *readList = nullptr;
+        return OPENDAQ_SUCCESS;
+    }
+
+    if (item.type != BinaryToken::startList)
+        return OPENDAQ_ERR_INVALIDTYPE;
+
+    index++;
+    return BinaryDeserializer::Deserialize(document, item, context, factoryCallback, reinterpret_cast<IBaseObject**>(readList));
+}
+
+ErrCode BinarySerializedList::readObject(IBaseObject* context, IFunction* factoryCallback, IBaseObject** obj)
+{
+    OPENDAQ_PARAM_NOT_NULL(obj);
+
+    if (index >= list->items.size())
+        return OPENDAQ_ERR_OUTOFRANGE;
+
+    return BinaryDeserializer::Deserialize(document, list->items[index++], context, factoryCallback, obj);
+}
+
+ErrCode BinarySerializedList::readString(IString** string)
+{
+    OPENDAQ_PARAM_NOT_NULL(string);
+
+    if (index >= list->items.size())
+        return OPENDAQ_ERR_OUTOFRANGE;
+
+    const auto& item = list->items[index];
+    if (item.type == BinaryToken::null)
+    {
+        index++;
+        *string = nullptr;
+        return OPENDAQ_SUCCESS;
+    }
+
+    if (item.type != BinaryToken::string)
+        return OPENDAQ_ERR_INVALIDTYPE;
+
+    index++;
+    return createStringN(string, item.stringValue.data(), item.stringValue.size());
+}
+
+ErrCode BinarySerializedList::readBool(Bool* boolean)
+{
+    OPENDAQ_PARAM_NOT_NULL(boolean);
+
+    if (index >= list->items.size())
+        return OPENDAQ_ERR_OUTOFRANGE;
+
+    const auto& item = list->items[index];
+    if (item.type != BinaryToken::boolTrue && item.type != BinaryToken::boolFalse)
+        return OPENDAQ_ERR_INVALIDTYPE;
+
+    index++;
+    *boolean = item.type == BinaryToken::boolTrue;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode BinarySerializedList::readFloat(Float* real)
+{
+    OPENDAQ_PARAM_NOT_NULL(real);
+
+    if (index >= list->items.size())
+        return OPENDAQ_ERR_OUTOFRANGE;
+
+    const auto& item = list->items[index];
+    if (item.type != BinaryToken::floating)
+        return OPENDAQ_ERR_INVALIDTYPE;
+
+    index++;
+    *real = item.floatValue;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode BinarySerializedList::readInt(Int* integer)
+{
+    OPENDAQ_PARAM_NOT_NULL(integer);
+
+    if (index >= list->items.size())
+        return OPENDAQ_ERR_OUTOFRANGE;
+
+    const auto& item = list->items[index];
+    if (item.type != BinaryToken::integer)
+        return OPENDAQ_ERR_INVALIDTYPE;
+
+    index++;
+    *integer = item.intValue;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode BinarySerializedList::getCount(SizeT* size)
+{
+    OPENDAQ_PARAM_NOT_NULL(size);
+
+    *size = list->items.size();
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode BinarySerializedList::getCurrentItemType(CoreType* type)
+{
+    OPENDAQ_PARAM_NOT_NULL(type);
+
+    if (index >= list->items.size())
+        return OPENDAQ_ERR_OUTOFRANGE;
+
+    *type = BinaryDeserializer::GetCoreType(list->items[index]);
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode BinarySerializedList::toString(CharPtr* str)
+{
+    OPENDAQ_PARAM_NOT_NULL(str);
+
+    return daqDuplicateCharPtr("BinarySerializedList", str);
+}
+
+}
@@ -0,0 +1,235 @@
+#include <packet_streaming/binary_serializer.h>
+#include <coretypes/serializable.h>
+#include <coretypes/stringobject.h>
+#include <cstring>
+
+namespace daq::packet_streaming
+{
+
+BinarySerializerImpl::BinarySerializerImpl()
+    : depth(0)
+    , started(false)
+{
+}
+
+ErrCode BinarySerializerImpl::startTaggedObject(ISerializable* serializable)
+{
+    if (!serializable)
+        return OPENDAQ_ERR_ARGUMENT_NULL;
+
+    ConstCharPtr id;
+    ErrCode errCode = serializable->getSerializeId(&id);
+    if (OPENDAQ_FAILED(errCode))
+        return errCode;
+
+    writeToken(BinaryToken::startTaggedObject);
+    writeInterned(id, std::strlen(id));
+    depth++;
+    started = true;
+
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode BinarySerializerImpl::startObject()
+{
+    writeToken(BinaryToken::startObject);
+    depth++;
+    started = true;
+
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode BinarySerializerImpl::endObject()
+{
+    if (depth == 0)
+        return OPENDAQ_ERR_INVALIDSTATE;
+
+    writeToken(BinaryToken::end);
+    depth--;
+
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode BinarySerializerImpl::startList()
+{
+    writeToken(BinaryToken::startList);
+    depth++;
+    started = true;
+
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode BinarySerializerImpl::endList()
+{
+    return endObject();
+}
+
+ErrCode BinarySerializerImpl::getOutput(IString** /*serialized*/)
+{
+    // The binary output is not a valid null-terminated string
+    return OPENDAQ_ERR_NOTIMPLEMENTED;
+}
+
+ErrCode BinarySerializerImpl::key(ConstCharPtr string)
+{
+    if (string == nullptr)
+        return OPENDAQ_ERR_ARGUMENT_NULL;
+
+    return keyRaw(string, std::strlen(string));
+}
+
+ErrCode BinarySerializerImpl::keyStr(IString* name)
+{
+    if (name == nullptr)
+        return OPENDAQ_ERR_ARGUMENT_NULL;
+
+    ConstCharPtr str;
+    ErrCode errCode = name->getCharPtr(&str);
+    if (OPENDAQ_FAILED(errCode))
+        return errCode;
+
+    return key(str);
+}
+
+ErrCode BinarySerializerImpl::keyRaw(ConstCharPtr string, SizeT length)
+{
+    if (string == nullptr)
+        return OPENDAQ_ERR_ARGUMENT_NULL;
+
+    if (length == 0)
+        return OPENDAQ_ERR_INVALIDPARAMETER;
+
+    writeToken(BinaryToken::key);
+    writeInterned(string, length);
+
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode BinarySerializerImpl::writeInt(Int integer)
+{
+    writeToken(BinaryToken::integer);
+
+    // zig-zag encoding keeps small negative values short
+    const auto value = static_cast<uint64_t>(integer);
+    writeVarUInt((value << 1) ^ static_cast<uint64_t>(integer >> 63));
+    valueWritten();
+
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode BinarySerializerImpl::writeBool(Bool boolean)
+{
+    writeToken(boolean ? BinaryToken::boolTrue : BinaryToken::boolFalse);
+    valueWritten();
+
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode BinarySerializerImpl::writeFloat(Float real)
+{
+    writeToken(BinaryToken::floating);
+
+    const auto offset = buffer.size();
+    buffer.resize(offset + sizeof(Float));
+    std::memcpy(buffer.data() + offset, &real, sizeof(Float));
+    valueWritten();
+
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode BinarySerializerImpl::writeString(ConstCharPtr string, SizeT length)
+{
+    if (string == nullptr)
+        return writeNull();
+
+    writeToken(BinaryToken::string);
+    writeVarUInt(length);
+    buffer.insert(buffer.end(), string, string + length);
+    valueWritten();
+
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode BinarySerializerImpl::writeNull()
+{
+    writeToken(BinaryToken::null);
+    valueWritten();
+
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode BinarySerializerImpl::reset()
+{
+    buffer.clear();
+    internedStrings.clear();
+    depth = 0;
+    started = false;
+
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode BinarySerializerImpl::isComplete(Bool* complete)
+{
+    if (complete == nullptr)
+        return OPENDAQ_ERR_ARGUMENT_NULL;
+
+    *complete = started && depth == 0;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode BinarySerializerImpl::toString(CharPtr* str)
+{
+    if (str == nullptr)
+        return OPENDAQ_ERR_ARGUMENT_NULL;
+
+    return daqDuplicateCharPtr("BinarySerializer", str);
+}
+
+const std::vector<uint8_t>& BinarySerializerImpl::getBuffer() const
+{
+    return buffer;
+}
+
+std::vector<uint8_t> BinarySerializerImpl::takeBuffer()
+{
+    std::vector<uint8_t> output;
+    output.swap(buffer);
+    reset();
+    return output;
+}
+
+void BinarySerializerImpl::writeToken(BinaryToken token)
+{
+    buffer.push_back(static_cast<uint8_t>(token));
+}
+
+void BinarySerializerImpl::writeVarUInt(uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        buffer.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    buffer.push_back(static_cast<uint8_t>(value));
+}
+
+void BinarySerializerImpl::writeInterned(const char* string, size_t length)
+{
+    // The lowest bit tells a literal (1) from a reference to an earlier literal (0)
+    auto [it, inserted] = internedStrings.try_emplace(std::string(string, length), internedStrings.size());
+    if (!inserted)
+    {
+        writeVarUInt(it->second << 1);
+        return;
+    }
+
+    writeVarUInt((static_cast<uint64_t>(length) << 1) | 1);
+    buffer.insert(buffer.end(), string, string + length);
+}
+
+void BinarySerializerImpl::valueWritten()
+{
+    started = true;
+}
+
+}
@@ -10,6 +10,13 @@ PacketBuffer::PacketBuffer(GenericPacketHeader* packetHeader, const void* payloa
 {
 }
 
+PacketBuffer::PacketBuffer(GenericPacketHeader* packetHeader, const void* payload, std::shared_ptr<void> storage)
+    : packetHeader(packetHeader)
+    , payload(payload)
+    , onDestroy([]() {})
+    , storage(std::move(storage))
+{
+}
 
 PacketBuffer::PacketBuffer(PacketBuffer&& packetBuffer) noexcept
 {
@@ -17,6 +24,7 @@ PacketBuffer::PacketBuffer(PacketBuffer&& packetBuffer) noexcept
     payload = packetBuffer.payload;
 
     onDestroy = packetBuffer.onDestroy;
+    storage = std::move(packetBuffer.storage);
 
     packetBuffer.onDestroy = [](){};
     packetBuffer.packetHeader = nullptr;
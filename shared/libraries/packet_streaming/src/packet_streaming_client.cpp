@@ -1,4 +1,5 @@
 #include <packet_streaming/packet_streaming_client.h>
+#include <packet_streaming/payload_codec.h>
 #include <opendaq/event_packet_ids.h>
 #include <opendaq/event_packet_params.h>
 #include <opendaq/packet_factory.h>
@@ -68,9 +69,18 @@ void PacketStreamingClient::addEventPacketBuffer(const PacketBufferPtr& packetBu
     bool forwardPacket = true;
     auto signalId = packetBuffer->packetHeader->signalId;
 
-    const auto eventPayloadString = String((ConstCharPtr) packetBuffer->payload);
-
-    EventPacketPtr packet = jsonDeserializer.deserialize(eventPayloadString);
+    EventPacketPtr packet;
+    switch (packetBuffer->packetHeader->version)
+    {
+        case 0:
+            packet = jsonDeserializer.deserialize(String((ConstCharPtr) packetBuffer->payload));
+            break;
+        case PacketVersionEventBinary:
+            packet = binaryDeserializer.deserialize(packetBuffer->payload, packetBuffer->packetHeader->payloadSize);
+            break;
+        default:
+            throw PacketStreamingException("Unsupported event packet version");
+    }
 
     if (packet.getEventId() == event_packet_id::DATA_DESCRIPTOR_CHANGED)
     {
@@ -148,6 +158,14 @@ DataPacketPtr PacketStreamingClient::addDataPacketBuffer(const PacketBufferPtr&
         packet = DataPacketWithDomain(domPacket, valueDescriptor, dataPacketHeader->sampleCount, offset);
         assert(packet.getRawData() == nullptr);
     }
+    else if (dataPacketHeader->genericHeader.flags & PACKET_FLAG_COMPRESSED)
+    {
+        packet = DataPacketWithDomain(domPacket, valueDescriptor, dataPacketHeader->sampleCount, offset);
+        DeltaBitPackCodec::decode(packetBuffer->payload,
+                                  dataPacketHeader->genericHeader.payloadSize,
+                                  packet.getRawData(),
+                                  packet.getRawDataSize());
+    }
     else
     {
         packet = DataPacketWithExternalMemory(domPacket,
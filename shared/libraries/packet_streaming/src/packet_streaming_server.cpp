@@ -1,4 +1,6 @@
 #include <packet_streaming/packet_streaming_server.h>
+#include <packet_streaming/binary_serializer.h>
+#include <packet_streaming/payload_codec.h>
 #include <opendaq/event_packet_ids.h>
 #include <opendaq/packet_destruct_callback_factory.h>
 #include <opendaq/event_packet_params.h>
@@ -6,8 +8,11 @@
 namespace daq::packet_streaming
 {
 
-PacketStreamingServer::PacketStreamingServer(size_t releaseThreshold)
+PacketStreamingServer::PacketStreamingServer(size_t releaseThreshold, bool binaryEventPackets)
     : jsonSerializer(JsonSerializer())
+    , binarySerializer(createWithImplementation<ISerializer, BinarySerializerImpl>())
+    , binaryEventPackets(binaryEventPackets)
+    , payloadCompression(false)
     , packetCollection(std::make_shared<PacketCollection>())
     , releaseThreshold(releaseThreshold)
 {
@@ -71,29 +76,55 @@ void PacketStreamingServer::addEventPacket(const uint32_t signalId, const EventP
     packetHeader->flags = 0;
     packetHeader->signalId = signalId;
 
+    const auto packetBuffer = binaryEventPackets
+                                  ? createBinaryEventPacketBuffer(packetHeader, packet)
+                                  : createJsonEventPacketBuffer(packetHeader, packet);
+
+    if (packet.getEventId() == event_packet_id::DATA_DESCRIPTOR_CHANGED &&
+        packet.getParameters().get(event_packet_param::DATA_DESCRIPTOR).assigned())
+    {
+        const DataDescriptorPtr dataDescriptor = packet.getParameters().get(event_packet_param::DATA_DESCRIPTOR);
+        dataDescriptors.insert_or_assign(signalId, dataDescriptor);
+        compressionElementSizes.insert_or_assign(signalId, DeltaBitPackCodec::getElementSize(dataDescriptor));
+    }
+
+    queue.push(packetBuffer);
+}
+
+PacketBufferPtr PacketStreamingServer::createJsonEventPacketBuffer(GenericPacketHeader* packetHeader, const EventPacketPtr& packet)
+{
     jsonSerializer.reset();
     packet.serialize(jsonSerializer);
     auto serializedPacket = jsonSerializer.getOutput();
 
     packetHeader->payloadSize = static_cast<uint32_t>(serializedPacket.getLength() + 1);
 
-    const auto packetBuffer = std::make_shared<PacketBuffer>(
+    return std::make_shared<PacketBuffer>(
             packetHeader,
             reinterpret_cast<const void*>(serializedPacket.getCharPtr()),
             [packetHeader, serializedPacket]() mutable {
                 delete packetHeader;
                 serializedPacket.release();
         });
+}
 
-    if (packet.getEventId() == event_packet_id::DATA_DESCRIPTOR_CHANGED &&
-        packet.getParameters().get(event_packet_param::DATA_DESCRIPTOR).assigned())
-    {
-        dataDescriptors.insert_or_assign(
-            signalId,
-            packet.getParameters().get(event_packet_param::DATA_DESCRIPTOR));
-    }
+PacketBufferPtr PacketStreamingServer::createBinaryEventPacketBuffer(GenericPacketHeader* packetHeader, const EventPacketPtr& packet)
+{
+    binarySerializer.reset();
+    packet.serialize(binarySerializer);
+    auto serializedPacket = std::make_shared<std::vector<uint8_t>>(
+        static_cast<BinarySerializerImpl*>(binarySerializer.getObject())->takeBuffer());
 
-    queue.push(packetBuffer);
+    packetHeader->version = PacketVersionEventBinary;
+    packetHeader->payloadSize = static_cast<uint32_t>(serializedPacket->size());
+
+    return std::make_shared<PacketBuffer>(
+            packetHeader,
+            reinterpret_cast<const void*>(serializedPacket->data()),
+            [packetHeader, serializedPacket]() mutable {
+                delete packetHeader;
+                serializedPacket.reset();
+        });
 }
 
 template <bool CheckRefCount>
@@ -201,17 +232,38 @@ void PacketStreamingServer::addDataPacket(const uint32_t signalId, DataPacket&&
 
     const auto packetDataPtr = packet.getRawData();
     const auto packetDataSize = packetDataPtr != nullptr ? packet.getRawDataSize() : 0;
-    packetHeader->genericHeader.payloadSize = static_cast<uint32_t>(packetDataSize);
 
-    const auto packetBuffer = std::make_shared<PacketBuffer>(
-        reinterpret_cast<GenericPacketHeader*>(packetHeader),
-        packetDataPtr,
-        [packetHeader, packet = packet]() mutable
-        {
-            std::free(packetHeader);
-            packet.release();
-        }
-    );
+    PacketBufferPtr packetBuffer;
+    if (auto compressedPayload = compressPayload(signalId, packetDataPtr, packetDataSize))
+    {
+        packetHeader->genericHeader.flags |= PACKET_FLAG_COMPRESSED;
+        packetHeader->genericHeader.payloadSize = static_cast<uint32_t>(compressedPayload->size());
+
+        packetBuffer = std::make_shared<PacketBuffer>(
+            reinterpret_cast<GenericPacketHeader*>(packetHeader),
+            compressedPayload->data(),
+            [packetHeader, compressedPayload, packet = packet]() mutable
+            {
+                std::free(packetHeader);
+                compressedPayload.reset();
+                packet.release();
+            }
+        );
+    }
+    else
+    {
+        packetHeader->genericHeader.payloadSize = static_cast<uint32_t>(packetDataSize);
+
+        packetBuffer = std::make_shared<PacketBuffer>(
+            reinterpret_cast<GenericPacketHeader*>(packetHeader),
+            packetDataPtr,
+            [packetHeader, packet = packet]() mutable
+            {
+                std::free(packetHeader);
+                packet.release();
+            }
+        );
+    }
 
     if constexpr (isPacketRValue)
         packet.release();
@@ -253,6 +305,33 @@ void PacketStreamingServer::checkAndSendReleasePacket(bool force)
     queue.push(packetBuffer);
 }
 
+void PacketStreamingServer::setBinaryEventPackets(bool enabled)
+{
+    binaryEventPackets = enabled;
+}
+
+void PacketStreamingServer::setPayloadCompression(bool enabled)
+{
+    payloadCompression = enabled;
+}
+
+std::shared_ptr<std::vector<uint8_t>> PacketStreamingServer::compressPayload(uint32_t signalId, const void* data, size_t size) const
+{
+    if (!payloadCompression || size == 0)
+        return nullptr;
+
+    const auto it = compressionElementSizes.find(signalId);
+    if (it == compressionElementSizes.end() || it->second == 0)
+        return nullptr;
+
+    auto compressedPayload = std::make_shared<std::vector<uint8_t>>();
+    compressedPayload->reserve(size);
+    if (!DeltaBitPackCodec::encode(data, size, it->second, *compressedPayload))
+        return nullptr;
+
+    return compressedPayload;
+}
+
 void PacketStreamingServer::addAlreadySentPacket(uint32_t signalId, Int packetId, Int domainPacketId, bool markForRelease)
 {
     const auto packetHeader = static_cast<AlreadySentPacketHeader*>(std::malloc(sizeof(AlreadySentPacketHeader)));
@@ -0,0 +1,266 @@
+#include <packet_streaming/payload_codec.h>
+#include <packet_streaming/packet_streaming.h>
+#include <opendaq/sample_type_traits.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace daq::packet_streaming
+{
+
+namespace
+{
+
+uint64_t readElement(const uint8_t* src, size_t elementSize)
+{
+    uint64_t value = 0;
+    std::memcpy(&value, src, elementSize);
+    return value;
+}
+
+void writeElement(uint8_t* dst, uint64_t value, size_t elementSize)
+{
+    std::memcpy(dst, &value, elementSize);
+}
+
+// Interprets the difference modulo 2^(8 * elementSize) as a signed value and zigzag encodes it
+uint64_t encodeDelta(uint64_t current, uint64_t previous, size_t elementSize)
+{
+    const size_t shift = 64 - elementSize * 8;
+    const auto delta = static_cast<int64_t>((current - previous) << shift) >> shift;
+    return (static_cast<uint64_t>(delta) << 1) ^ static_cast<uint64_t>(delta >> 63);
+}
+
+uint64_t decodeDelta(uint64_t zigzag, uint64_t previous)
+{
+    const uint64_t delta = (zigzag >> 1) ^ (~(zigzag & 1) + 1);
+    return previous + delta;
+}
+
+uint8_t bitWidth(uint64_t value)
+{
+    uint8_t width = 0;
+    while (value != 0)
+    {
+        value >>= 1;
+        width++;
+    }
+    return width;
+}
+
+class BitWriter
+{
+public:
+    explicit BitWriter(std::vector<uint8_t>& output)
+        : output(output)
+    {
+    }
+
+    void write(uint64_t value, uint8_t width)
+    {
+        if (width == 0)
+            return;
+
+        accumulator |= value << bitCount;
+        if (bitCount + width < 64)
+        {
+            bitCount += width;
+            return;
+        }
+
+        flushBytes(8);
+        const uint8_t consumed = 64 - bitCount;
+        accumulator = consumed < 64 ? value >> consumed : 0;
+        bitCount = bitCount + width - 64;
+    }
+
+    // Pads the last byte, so that the next block starts byte aligned
+    void align()
+    {
+        flushBytes((bitCount + 7) / 8);
+        accumulator = 0;
+        bitCount = 0;
+    }
+
+private:
+    std::vector<uint8_t>& output;
+    uint64_t accumulator = 0;
+    uint8_t bitCount = 0;
+
+    void flushBytes(size_t count)
+    {
+        for (size_t i = 0; i < count; i++)
+            output.push_back(static_cast<uint8_t>(accumulator >> (i * 8)));
+    }
+};
+
+class BitReader
+{
+public:
+    BitReader(const uint8_t* begin, const uint8_t* end)
+        : current(begin)
+        , end(end)
+    {
+    }
+
+    uint8_t readByte()
+    {
+        if (current == end)
+            throw PacketStreamingException("Compressed payload is truncated");
+        return *current++;
+    }
+
+    uint64_t read(uint8_t width)
+    {
+        if (width == 0)
+            return 0;
+
+        uint64_t value = 0;
+        uint8_t valueBits = 0;
+        while (valueBits < width)
+        {
+            if (bitCount == 0)
+            {
+                accumulator = readByte();
+                bitCount = 8;
+            }
+
+            const uint8_t taken = std::min<uint8_t>(bitCount, width - valueBits);
+            value |= (accumulator & ((1u << taken) - 1)) << valueBits;
+            accumulator >>= taken;
+            bitCount -= taken;
+            valueBits += taken;
+        }
+
+        return value;
+    }
+
+    void align()
+    {
+        bitCount = 0;
+    }
+
+private:
+    const uint8_t* current;
+    const uint8_t* end;
+    uint64_t accumulator = 0;
+    uint8_t bitCount = 0;
+};
+
+}
+
+size_t DeltaBitPackCodec::getElementSize(const DataDescriptorPtr& descriptor)
+{
+    if (!descriptor.assigned())
+        return 0;
+
+    // post scaled packets carry the raw samples of the scaling input type
+    const auto postScaling = descriptor.getPostScaling();
+    const auto sampleType = postScaling.assigned() ? postScaling.getInputSampleType() : descriptor.getSampleType();
+
+    switch (sampleType)
+    {
+        case SampleType::Int8:
+        case SampleType::UInt8:
+        case SampleType::Int16:
+        case SampleType::UInt16:
+        case SampleType::Int32:
+        case SampleType::UInt32:
+        case SampleType::Int64:
+        case SampleType::UInt64:
+            return getSampleSize(sampleType);
+        default:
+            return 0;
+    }
+}
+
+bool DeltaBitPackCodec::encode(const void* data, size_t size, size_t elementSize, std::vector<uint8_t>& output)
+{
+    if (elementSize == 0 || elementSize > 8 || size % elementSize != 0 || size > std::numeric_limits<uint32_t>::max())
+        return false;
+
+    const auto initialSize = output.size();
+
+    CompressedPayloadHeader header{};
+    header.codecId = PayloadCodecId::deltaZigZagBitPack;
+    header.elementSize = static_cast<uint8_t>(elementSize);
+    header.rawSize = static_cast<uint32_t>(size);
+    output.resize(initialSize + sizeof(CompressedPayloadHeader));
+    std::memcpy(output.data() + initialSize, &header, sizeof(CompressedPayloadHeader));
+
+    const auto src = static_cast<const uint8_t*>(data);
+    const size_t elementCount = size / elementSize;
+
+    BitWriter writer(output);
+    uint64_t zigzag[BlockSize];
+    uint64_t previous = 0;
+
+    for (size_t blockStart = 0; blockStart < elementCount; blockStart += BlockSize)
+    {
+        const size_t blockCount = std::min(BlockSize, elementCount - blockStart);
+
+        uint64_t combined = 0;
+        for (size_t i = 0; i < blockCount; i++)
+        {
+            const uint64_t value = readElement(src + (blockStart + i) * elementSize, elementSize);
+            zigzag[i] = encodeDelta(value, previous, elementSize);
+            combined |= zigzag[i];
+            previous = value;
+        }
+
+        const uint8_t width = bitWidth(combined);
+        output.push_back(width);
+        for (size_t i = 0; i < blockCount; i++)
+            writer.write(zigzag[i], width);
+        writer.align();
+
+        if (output.size() - initialSize >= size)
+        {
+            output.resize(initialSize);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void DeltaBitPackCodec::decode(const void* payload, size_t payloadSize, void* data, size_t size)
+{
+    if (payloadSize < sizeof(CompressedPayloadHeader))
+        throw PacketStreamingException("Compressed payload is truncated");
+
+    CompressedPayloadHeader header;
+    std::memcpy(&header, payload, sizeof(CompressedPayloadHeader));
+
+    if (header.codecId != PayloadCodecId::deltaZigZagBitPack)
+        throw PacketStreamingException("Unsupported payload codec");
+
+    const size_t elementSize = header.elementSize;
+    if (elementSize == 0 || elementSize > 8 || header.rawSize != size || size % elementSize != 0)
+        throw PacketStreamingException("Compressed payload does not match the packet size");
+
+    const auto begin = static_cast<const uint8_t*>(payload) + sizeof(CompressedPayloadHeader);
+    BitReader reader(begin, static_cast<const uint8_t*>(payload) + payloadSize);
+
+    const auto dst = static_cast<uint8_t*>(data);
+    const size_t elementCount = size / elementSize;
+    uint64_t previous = 0;
+
+    for (size_t blockStart = 0; blockStart < elementCount; blockStart += BlockSize)
+    {
+        const size_t blockCount = std::min(BlockSize, elementCount - blockStart);
+        const uint8_t width = reader.readByte();
+        if (width > 64)
+            throw PacketStreamingException("Invalid compressed payload block");
+
+        for (size_t i = 0; i < blockCount; i++)
+        {
+            previous = decodeDelta(reader.read(width), previous);
+            writeElement(dst + (blockStart + i) * elementSize, previous, elementSize);
+        }
+        reader.align();
+    }
+}
+
+}
@@ -5,6 +5,9 @@
 #include <opendaq/data_descriptor_factory.h>
 #include <opendaq/data_rule_factory.h>
 #include <opendaq/packet_destruct_callback_factory.h>
+#include <opendaq/range_factory.h>
+#include <opendaq/scaling_factory.h>
+#include <coreobjects/unit_factory.h>
 #include "packet_transmission.h"
 
 using namespace daq;
@@ -65,6 +68,117 @@ TEST_F(PacketStreamingTest, EventPacket)
     ASSERT_EQ(descriptorEventPacket, clientEventPacket);
 }
 
+TEST_F(PacketStreamingTest, EventPacketBinaryEncoding)
+{
+    server.setBinaryEventPackets(true);
+
+    const auto valueDescriptor = DataDescriptorBuilder()
+                                     .setSampleType(SampleType::Float64)
+                                     .setName("Value")
+                                     .setUnit(Unit("V", -1, "volt", "voltage"))
+                                     .setValueRange(Range(-10.0, 10.0))
+                                     .setPostScaling(LinearScaling(2, 5, SampleType::Int16, ScaledSampleType::Float64))
+                                     .build();
+    const auto domainDescriptor = DataDescriptorBuilder()
+                                      .setSampleType(SampleType::Int64)
+                                      .setRule(LinearDataRule(10, -20))
+                                      .setTickResolution(Ratio(1, 1000))
+                                      .setOrigin("1970-01-01T00:00:00Z")
+                                      .build();
+    const auto serverEventPacket = DataDescriptorChangedEventPacket(valueDescriptor, domainDescriptor);
+
+    server.addDaqPacket(1, serverEventPacket);
+    const auto serverPacketBuffer = server.getNextPacketBuffer();
+    ASSERT_EQ(serverPacketBuffer->packetHeader->version, PacketVersionEventBinary);
+
+    transmission.sendPacketBuffer(serverPacketBuffer);
+    client.addPacketBuffer(transmission.recvPacketBuffer());
+    auto [signalId, clientEventPacket] = client.getNextDaqPacket();
+
+    ASSERT_EQ(signalId, 1u);
+    ASSERT_EQ(serverEventPacket, clientEventPacket);
+    ASSERT_EQ(client.getDataDescriptorChangedEventPacket(1), clientEventPacket);
+}
+
+TEST_F(PacketStreamingTest, DataPacketBinaryEncodedDescriptor)
+{
+    server.setBinaryEventPackets(true);
+
+    const auto valueDescriptor = DataDescriptorBuilder().setSampleType(SampleType::Int32).build();
+    server.addDaqPacket(1, DataDescriptorChangedEventPacket(valueDescriptor, nullptr));
+
+    constexpr size_t sampleCount = 10;
+    auto serverDataPacket = DataPacket(valueDescriptor, sampleCount);
+    auto data = static_cast<int32_t*>(serverDataPacket.getRawData());
+    for (size_t i = 0; i < sampleCount; i++)
+        *data++ = static_cast<int32_t>(i);
+
+    server.addDaqPacket(1, serverDataPacket);
+    transmitAll();
+
+    auto [eventSignalId, clientEventPacket] = client.getNextDaqPacket();
+    ASSERT_EQ(clientEventPacket.getType(), PacketType::Event);
+
+    auto [dataSignalId, clientPacket] = client.getNextDaqPacket();
+    DataPacketPtr clientDataPacket = clientPacket;
+    ASSERT_EQ(clientDataPacket.getDataDescriptor(), valueDescriptor);
+    ASSERT_EQ(std::memcmp(clientDataPacket.getRawData(), serverDataPacket.getRawData(), sampleCount * sizeof(int32_t)), 0);
+}
+
+TEST_F(PacketStreamingTest, DataPacketCompressed)
+{
+    server.setPayloadCompression(true);
+
+    const auto valueDescriptor = DataDescriptorBuilder().setSampleType(SampleType::Int32).build();
+    server.addDaqPacket(1, DataDescriptorChangedEventPacket(valueDescriptor, nullptr));
+    transmitAll();
+
+    constexpr size_t sampleCount = 1000;
+    auto serverDataPacket = DataPacket(valueDescriptor, sampleCount, 1024);
+    auto data = static_cast<int32_t*>(serverDataPacket.getRawData());
+    int32_t value = 100000;
+    for (size_t i = 0; i < sampleCount; i++)
+    {
+        value += static_cast<int32_t>(i % 5) - 2;
+        *data++ = value;
+    }
+
+    server.addDaqPacket(1, serverDataPacket);
+    const auto serverPacketBuffer = server.getNextPacketBuffer();
+    ASSERT_TRUE(serverPacketBuffer->packetHeader->flags & PACKET_FLAG_COMPRESSED);
+    ASSERT_LT(serverPacketBuffer->packetHeader->payloadSize, sampleCount * sizeof(int32_t));
+
+    transmission.sendPacketBuffer(serverPacketBuffer);
+    client.addPacketBuffer(transmission.recvPacketBuffer());
+
+    client.getNextDaqPacket();
+    auto [signalId, clientPacket] = client.getNextDaqPacket();
+    ASSERT_EQ(signalId, 1u);
+    ASSERT_EQ(serverDataPacket, clientPacket);
+
+    serverDataPacket.release();
+    completeTransmitAll();
+    ASSERT_TRUE(client.areReferencesCleared());
+}
+
+TEST_F(PacketStreamingTest, DataPacketFloatNotCompressed)
+{
+    server.setPayloadCompression(true);
+
+    const auto valueDescriptor = DataDescriptorBuilder().setSampleType(SampleType::Float32).build();
+    server.addDaqPacket(1, DataDescriptorChangedEventPacket(valueDescriptor, nullptr));
+    server.getNextPacketBuffer();
+
+    constexpr size_t sampleCount = 100;
+    auto serverDataPacket = DataPacket(valueDescriptor, sampleCount);
+    std::memset(serverDataPacket.getRawData(), 0, sampleCount * sizeof(float));
+
+    server.addDaqPacket(1, serverDataPacket);
+    const auto serverPacketBuffer = server.getNextPacketBuffer();
+    ASSERT_FALSE(serverPacketBuffer->packetHeader->flags & PACKET_FLAG_COMPRESSED);
+    ASSERT_EQ(serverPacketBuffer->packetHeader->payloadSize, sampleCount * sizeof(float));
+}
+
 TEST_F(PacketStreamingTest, DataPacket)
 {
     const auto valueDescriptor = DataDescriptorBuilder().setSampleType(SampleType::Float32).build();
@@ -19,7 +19,9 @@
 #include "websocket_streaming/websocket_streaming.h"
 #include <opendaq/device_ptr.h>
 #include <opendaq/reader_factory.h>
-#include <queue>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
 
 BEGIN_NAMESPACE_OPENDAQ_WEBSOCKET_STREAMING
 
@@ -34,23 +36,40 @@ public:
     void start();
     void stop();
     void onPacket(const OnPacketCallback& callback);
-    void setLoopFrequency(uint32_t freqency);
+
+    // Reads are driven by packet notifications, so there is no loop to configure
+    [[deprecated("Packets are read when they arrive; the loop frequency has no effect")]]
+    void setLoopFrequency(uint32_t frequency);
+
     void startReadSignal(const SignalPtr& signal);
     void stopReadSignal(const SignalPtr& signal);
 
 protected:
+    struct SignalReader
+    {
+        SignalPtr signal;
+        PacketReaderPtr reader;
+        std::atomic<bool> ready{false};
+        bool removed{false};
+    };
+
     void startReadThread();
     void createReaders();
     void addReader(SignalPtr signalToRead);
     void removeReader(SignalPtr signalToRead);
+    void markReaderReady(const std::shared_ptr<SignalReader>& signalReader);
 
     DevicePtr device;
     ContextPtr context;
     OnPacketCallback onPacketCallback;
     std::thread readThread;
     bool readThreadStarted = false;
-    std::chrono::milliseconds sleepTime;
-    std::vector<std::pair<SignalPtr, PacketReaderPtr>> signalReaders;
+    std::vector<std::shared_ptr<SignalReader>> signalReaders;
+
+    // Readers with pending packets, filled from the packet notification path and drained by the read thread
+    std::mutex readySync;
+    std::condition_variable readyCondition;
+    std::vector<std::shared_ptr<SignalReader>> readyReaders;
 
     LoggerPtr logger;
     LoggerComponentPtr loggerComponent;
@@ -11,7 +11,6 @@ AsyncPacketReader::AsyncPacketReader(const DevicePtr& device, const ContextPtr&
     , logger(context.getLogger())
     , loggerComponent(logger.getOrAddComponent("WebsocketStreamingPacketReader"))
 {
-    setLoopFrequency(50);
     onPacketCallback = [](const SignalPtr& signal, const ListPtr<IPacket>& packets) {};
 }
 
@@ -22,7 +21,11 @@ AsyncPacketReader::~AsyncPacketReader()
 
 void AsyncPacketReader::start()
 {
-    readThreadStarted = true;
+    {
+        std::scoped_lock lock(readySync);
+        readThreadStarted = true;
+    }
+
     this->readThread = std::thread([this]()
     {
         this->startReadThread();
@@ -32,14 +35,23 @@ void AsyncPacketReader::start()
 
 void AsyncPacketReader::stop()
 {
-    readThreadStarted = false;
+    {
+        std::scoped_lock lock(readySync);
+        readThreadStarted = false;
+    }
+    readyCondition.notify_all();
+
     if (readThread.joinable())
     {
         readThread.join();
         LOG_I("Reading thread joined");
     }
 
+    std::scoped_lock lock(readersSync);
+    for (const auto& signalReader : signalReaders)
+        signalReader->reader.setOnDataAvailable(nullptr);
     signalReaders.clear();
+    readyReaders.clear();
 }
 
 void AsyncPacketReader::onPacket(const OnPacketCallback& callback)
@@ -47,30 +59,55 @@ void AsyncPacketReader::onPacket(const OnPacketCallback& callback)
     onPacketCallback = callback;
 }
 
-void AsyncPacketReader::setLoopFrequency(uint32_t freqency)
+void AsyncPacketReader::setLoopFrequency(uint32_t /*frequency*/)
 {
-    uint64_t sleepMs = 1000.0 / freqency;
-    this->sleepTime = std::chrono::milliseconds(sleepMs);
 }
 
 void AsyncPacketReader::startReadThread()
 {
-    while (readThreadStarted)
+    std::vector<std::shared_ptr<SignalReader>> pendingReaders;
+
+    while (true)
     {
+        {
+            std::unique_lock lock(readySync);
+            readyCondition.wait(lock, [this] { return !readThreadStarted || !readyReaders.empty(); });
+            if (!readThreadStarted)
+                break;
+
+            std::swap(pendingReaders, readyReaders);
+        }
+
         {
             std::scoped_lock lock(readersSync);
-            for (const auto& [signal, reader] : signalReaders)
+            for (const auto& signalReader : pendingReaders)
             {
-                if (reader.getAvailableCount() == 0)
+                if (signalReader->removed)
                     continue;
 
-                const auto& packets = reader.readAll();
-                onPacketCallback(signal, packets);
+                // Cleared before reading so that packets arriving meanwhile mark the reader ready again
+                signalReader->ready.store(false, std::memory_order_release);
+
+                const auto& packets = signalReader->reader.readAll();
+                if (packets.getCount() > 0)
+                    onPacketCallback(signalReader->signal, packets);
             }
         }
 
-        std::this_thread::sleep_for(sleepTime);
+        pendingReaders.clear();
+    }
+}
+
+void AsyncPacketReader::markReaderReady(const std::shared_ptr<SignalReader>& signalReader)
+{
+    if (signalReader->ready.exchange(true, std::memory_order_acq_rel))
+        return;
+
+    {
+        std::scoped_lock lock(readySync);
+        readyReaders.push_back(signalReader);
     }
+    readyCondition.notify_one();
 }
 
 void AsyncPacketReader::createReaders()
@@ -103,30 +140,47 @@ void AsyncPacketReader::addReader(SignalPtr signalToRead)
 
     auto it = std::find_if(signalReaders.begin(),
                            signalReaders.end(),
-                           [&signalToRead](const std::pair<SignalPtr, PacketReaderPtr>& element)
+                           [&signalToRead](const std::shared_ptr<SignalReader>& element)
                            {
-                               return element.first == signalToRead;
+                               return element->signal == signalToRead;
                            });
     if (it != signalReaders.end())
         return;
 
     LOG_I("Add reader for signal {}", signalToRead.getGlobalId());
-    auto reader = PacketReader(signalToRead);
-    signalReaders.push_back(std::pair<SignalPtr, PacketReaderPtr>({signalToRead, reader}));
+    auto signalReader = std::make_shared<SignalReader>();
+    signalReader->signal = signalToRead;
+    signalReader->reader = PacketReader(signalToRead);
+
+    // The notification runs on the thread that sent the packet, so it only marks the reader as ready
+    // and leaves reading and sending to the read thread
+    std::weak_ptr<SignalReader> signalReaderWeak = signalReader;
+    signalReader->reader.setOnDataAvailable([this, signalReaderWeak]
+    {
+        if (const auto signalReader = signalReaderWeak.lock())
+            markReaderReady(signalReader);
+    });
+
+    signalReaders.push_back(signalReader);
+
+    // Packets enqueued on connect (e.g. the initial descriptor-changed event) precede the notification callback
+    markReaderReady(signalReader);
 }
 
 void AsyncPacketReader::removeReader(SignalPtr signalToRead)
 {
     auto it = std::find_if(signalReaders.begin(),
                            signalReaders.end(),
-                           [&signalToRead](const std::pair<SignalPtr, PacketReaderPtr>& element)
+                           [&signalToRead](const std::shared_ptr<SignalReader>& element)
                            {
-                               return element.first == signalToRead;
+                               return element->signal == signalToRead;
                            });
     if (it == signalReaders.end())
         return;
 
     LOG_I("Remove reader for signal {}", signalToRead.getGlobalId());
+    (*it)->removed = true;
+    (*it)->reader.setOnDataAvailable(nullptr);
     signalReaders.erase(it);
 }
 
@@ -52,7 +52,6 @@ void WebsocketStreamingServer::start()
     streamingServer.onUnsubscribe([this](const daq::SignalPtr& signal) { packetReader.stopReadSignal(signal); } );
     streamingServer.start(streamingPort, controlPort);
 
-    packetReader.setLoopFrequency(50);
     packetReader.onPacket([this](const SignalPtr& signal, const ListPtr<IPacket>& packets) {
         const auto signalId = signal.getGlobalId();
         for (const auto& packet : packets)
@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include <opendaq/context_factory.h>
+#include <opendaq/event_packet_ids.h>
+#include <opendaq/event_packet_ptr.h>
+#include <opendaq/packet_factory.h>
+#include <opendaq/signal_factory.h>
+#include <websocket_streaming/async_packet_reader.h>
+#include "streaming_test_helpers.h"
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+using namespace daq;
+using namespace daq::websocket_streaming;
+
+class AsyncPacketReaderTest : public testing::Test
+{
+public:
+    ContextPtr context;
+    SignalConfigPtr signal;
+
+    std::mutex sync;
+    std::condition_variable condition;
+    std::vector<PacketPtr> received;
+
+    void SetUp() override
+    {
+        context = NullContext();
+        signal = streaming_test_helpers::createTestSignalWithoutDomain(context);
+    }
+
+    AsyncPacketReader::OnPacketCallback onPacket()
+    {
+        return [this](const SignalPtr& /*signal*/, const ListPtr<IPacket>& packets)
+        {
+            {
+                std::scoped_lock lock(sync);
+                for (const auto& packet : packets)
+                    received.push_back(packet);
+            }
+            condition.notify_all();
+        };
+    }
+
+    bool waitForPackets(size_t count, std::chrono::milliseconds timeout = std::chrono::seconds(5))
+    {
+        std::unique_lock lock(sync);
+        return condition.wait_for(lock, timeout, [this, count] { return received.size() >= count; });
+    }
+};
+
+TEST_F(AsyncPacketReaderTest, StreamsPacketsAfterStartReadSignal)
+{
+    AsyncPacketReader reader(nullptr, context);
+    reader.onPacket(onPacket());
+    reader.start();
+    reader.startReadSignal(signal);
+
+    // The descriptor-changed event queued on connect is sent without a packet notification
+    ASSERT_TRUE(waitForPackets(1));
+    {
+        std::scoped_lock lock(sync);
+        const auto eventPacket = received[0].asPtrOrNull<IEventPacket>();
+        ASSERT_TRUE(eventPacket.assigned());
+        ASSERT_EQ(eventPacket.getEventId(), event_packet_id::DATA_DESCRIPTOR_CHANGED);
+    }
+
+    const auto dataPacket = DataPacket(signal.getDescriptor(), 10);
+    signal.sendPacket(dataPacket);
+
+    ASSERT_TRUE(waitForPackets(2));
+    std::scoped_lock lock(sync);
+    ASSERT_EQ(received.size(), 2u);
+    ASSERT_EQ(received[1], dataPacket);
+}
+
+TEST_F(AsyncPacketReaderTest, StopReadSignal)
+{
+    AsyncPacketReader reader(nullptr, context);
+    reader.onPacket(onPacket());
+    reader.start();
+    reader.startReadSignal(signal);
+    ASSERT_TRUE(waitForPackets(1));
+
+    reader.stopReadSignal(signal);
+    signal.sendPacket(DataPacket(signal.getDescriptor(), 10));
+
+    ASSERT_FALSE(waitForPackets(2, std::chrono::milliseconds(200)));
+}